@@ -43,4 +43,5 @@
 #include "storage.hpp"
 #include "engine.hpp"
 #include "tensor.hpp"
+#include "ops/math/expression.hpp"
 
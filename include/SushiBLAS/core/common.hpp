@@ -55,6 +55,44 @@ namespace SushiBLAS
             COMPLEX64
         };
 
+        /**
+         * @brief Get the size of one element of a data type.
+         * @param dtype The data type.
+         * @return Size in bytes.
+         */
+        inline constexpr size_t element_size(DataType dtype)
+        {
+            switch (dtype)
+            {
+                case DataType::HALF: return 2;
+                case DataType::FLOAT64: return 8;
+                case DataType::COMPLEX32: return 8;
+                case DataType::COMPLEX64: return 16;
+                default: return 4;
+            }
+        }
+
+        /** @brief Activation functions that can be fused into other operations. */
+        enum class Activation : uint8_t
+        {
+            NONE,
+            RELU,
+            LEAKY_RELU,
+            GELU,
+            SILU,
+            SIGMOID,
+            TANH
+        };
+
+        /** @brief How the engine sends queued tasks to the device. */
+        enum class ExecutionMode : uint8_t
+        {
+            /** Tasks go to the runtime TaskGraph and its worker threads poll for completion. */
+            SCHEDULED,
+            /** Tasks are submitted directly with their dependency events, so the device driver starts successors. */
+            EVENT_DRIVEN
+        };
+
         /** @brief Maximum number of supported tensor ranks. */
         inline constexpr size_t MAX_TENSOR_RANK = 6;
         
@@ -30,20 +30,27 @@
 
 #pragma once
 
+#include <bit>
+#include <array>
 #include <mutex>
-#include <queue>
 #include <atomic>
 #include <chrono>
 #include <cstdio>
 #include <format>
+#include <memory>
 #include <string>
 #include <thread>
+#include <vector>
+#include <cstring>
 #include <utility>
+#include <variant>
 #include <iostream>
+#include <iterator>
+#include <algorithm>
 #include <stdexcept>
 #include <string_view>
+#include <type_traits>
 #include <source_location>
-#include <condition_variable>
 
 #ifndef SB_ENABLE_LOGGING
     #define SB_ENABLE_LOGGING 1
@@ -65,6 +72,25 @@ namespace SushiBLAS
             DEBUG = 4  /**< All messages including debug */
         };
 
+        /**
+         * @brief Parts of the library that have their own runtime log level.
+         * 
+         * The category of a message is found at compile time from the path of the 
+         * source file that logs it.
+         */
+        enum class LogCategory : int 
+        {
+            CORE   = 0, /**< Engine, tensors and everything else */
+            BLAS   = 1, /**< ops/blas */
+            MATH   = 2, /**< ops/math */
+            LOGIC  = 3, /**< ops/logic */
+            LAPACK = 4, /**< ops/lapack */
+            SIGNAL = 5, /**< ops/signal */
+            IO     = 6, /**< Tensor loading and saving */
+            GRAPH  = 7, /**< Task graph passes */
+            COUNT  = 8
+        };
+
         #if SB_ENABLE_LOGGING
             #ifdef NDEBUG
                 inline constexpr LogType ACTIVE_LOG_LEVEL = LogType::INFO;
@@ -80,115 +106,223 @@ namespace SushiBLAS
          */
         namespace Detail 
         {
-            class AsyncLogger 
+            inline constexpr size_t CATEGORY_COUNT = static_cast<size_t>(LogCategory::COUNT);
+            inline constexpr std::array<const char*, CATEGORY_COUNT> CATEGORY_NAMES = 
+                {"CORE", "BLAS", "MATH", "LOGIC", "LAPACK", "SIGNAL", "IO", "GRAPH"};
+
+            /**
+             * @brief Checks if a path contains a part, treating '\' as '/'.
+             * @param path The file path.
+             * @param part The part to look for, written with '/'.
+             * @return True if the part is found.
+             */
+            constexpr bool path_contains(std::string_view path, std::string_view part)
             {
-                private:
-                    std::queue<std::pair<LogType, std::string>> queue_;
-                    std::mutex mutex_;
-                    std::condition_variable cv_;
-                    std::thread worker_;
-                    std::atomic<bool> running_;
+                for (size_t i = 0; i + part.size() <= path.size(); ++i)
+                {
+                    size_t j = 0;
+                    while (j < part.size() && (path[i + j] == part[j] || (path[i + j] == '\\' && part[j] == '/'))) ++j;
+                    if (j == part.size()) return true;
+                }
+                return false;
+            }
 
-                    void process_logs() 
-                    {
-                        while (running_.load(std::memory_order_relaxed)) 
-                        {
-                            std::unique_lock<std::mutex> lock(mutex_);
-                            cv_.wait(lock, [this]() { return !queue_.empty() || !running_.load(std::memory_order_relaxed); });
+            /**
+             * @brief Finds the log category of a source file.
+             * @param path The file name of a std::source_location.
+             * @return The category of the file.
+             */
+            constexpr LogCategory category_of(const char* path)
+            {
+                std::string_view p(path);
+                if (path_contains(p, "ops/blas/")) return LogCategory::BLAS;
+                if (path_contains(p, "ops/math/")) return LogCategory::MATH;
+                if (path_contains(p, "ops/logic/")) return LogCategory::LOGIC;
+                if (path_contains(p, "ops/lapack/")) return LogCategory::LAPACK;
+                if (path_contains(p, "ops/signal/")) return LogCategory::SIGNAL;
+                if (path_contains(p, "/graph/")) return LogCategory::GRAPH;
+                if (path_contains(p, "/io.") || path_contains(p, "/io/")) return LogCategory::IO;
+                return LogCategory::CORE;
+            }
 
-                            while (!queue_.empty()) 
-                            {
-                                auto log_entry = std::move(queue_.front());
-                                queue_.pop();
-                                lock.unlock(); // Unlock while writing to file/terminal
-
-                                FILE* stream = (log_entry.first <= LogType::ERR) ? stderr : stdout;
-
-                                #ifdef _WIN32
-                                    _lock_file(stream);
-                                    fputs(log_entry.second.c_str(), stream);
-                                    fflush(stream);
-                                    _unlock_file(stream);
-                                #else
-                                    flockfile(stream);
-                                    fputs(log_entry.second.c_str(), stream);
-                                    fflush(stream);
-                                    funlockfile(stream);
-                                #endif
-
-                                lock.lock(); // Lock again before checking queue
-                            }
-                        }
-                    }
+            /** @brief The runtime level of each category. */
+            inline std::array<std::atomic<int>, CATEGORY_COUNT>& log_levels()
+            {
+                static std::array<std::atomic<int>, CATEGORY_COUNT> levels = []<size_t... I>(std::index_sequence<I...>) 
+                {
+                    return std::array<std::atomic<int>, CATEGORY_COUNT>{((void)I, static_cast<int>(ACTIVE_LOG_LEVEL))...};
+                }(std::make_index_sequence<CATEGORY_COUNT>{});
+                return levels;
+            }
+        } // namespace Detail
 
-                public:
-                    AsyncLogger() : running_(true) 
-                    {
-                        worker_ = std::thread(&AsyncLogger::process_logs, this);
-                    }
+        /**
+         * @brief Sets the runtime log level of one category.
+         * 
+         * Levels above the compile time ACTIVE_LOG_LEVEL have no effect, since 
+         * those messages are removed from the build.
+         * @param category The category to change.
+         * @param level The most detailed level that is still logged.
+         */
+        inline void set_log_level(LogCategory category, LogType level)
+        {
+            Detail::log_levels()[static_cast<size_t>(category)].store(static_cast<int>(level), std::memory_order_relaxed);
+        }
 
-                    ~AsyncLogger() 
-                    {
-                        running_.store(false, std::memory_order_relaxed);
-                        cv_.notify_one();
+        /**
+         * @brief Sets the runtime log level of all categories.
+         * @param level The most detailed level that is still logged.
+         */
+        inline void set_log_level(LogType level)
+        {
+            for (auto& l : Detail::log_levels()) l.store(static_cast<int>(level), std::memory_order_relaxed);
+        }
 
-                        if (worker_.joinable()) 
-                        {
-                            worker_.join();
-                        }
-                    }
+        /**
+         * @brief Gets the runtime log level of a category.
+         * @param category The category to read.
+         * @return The most detailed level that is logged.
+         */
+        inline LogType get_log_level(LogCategory category)
+        {
+            return static_cast<LogType>(Detail::log_levels()[static_cast<size_t>(category)].load(std::memory_order_relaxed));
+        }
 
-                    void enqueue(LogType level, std::string&& msg) 
-                    {
-                        {
-                            std::lock_guard<std::mutex> lock(mutex_);
-                            queue_.emplace(level, std::move(msg));
-                        }
-                        cv_.notify_one();
-                    }
-            };
+        namespace Detail 
+        {
+            /** @brief The type of a stored log argument. */
+            enum class ArgTag : uint8_t { BOOL, CHAR, INT, UINT, FLOAT, PTR, TEXT };
 
-            class SyncLogger 
+            /**
+             * @brief A log message before formatting.
+             * 
+             * It holds the static format string and the raw arguments. Strings are 
+             * copied into `text`, since they may not live until the message is printed.
+             */
+            struct LogRecord 
             {
-                private:
-                    std::mutex sync_mutex_;
-                public:
-                    void enqueue(LogType level, std::string&& msg) 
-                    {
-                        std::lock_guard<std::mutex> lock(sync_mutex_);
-                        FILE* stream = (level <= LogType::ERR) ? stderr : stdout;
-                        #ifdef _WIN32
-                            _lock_file(stream);
-                            fputs(msg.c_str(), stream);
-                            fflush(stream);
-                            _unlock_file(stream);
-                        #else
-                            flockfile(stream);
-                            fputs(msg.c_str(), stream);
-                            fflush(stream);
-                            funlockfile(stream);
-                        #endif
-                    }
+                static constexpr size_t MAX_ARGS = 8;
+                static constexpr size_t TEXT_BYTES = 160;
+
+                uint64_t time_ns = 0;
+                std::string_view fmt;
+                std::source_location loc;
+                LogType level = LogType::OFF;
+                LogCategory category = LogCategory::CORE;
+                uint8_t arg_count = 0;
+                uint16_t text_used = 0;
+                std::array<ArgTag, MAX_ARGS> tags{};
+                std::array<uint64_t, MAX_ARGS> slots{};
+                std::array<char, TEXT_BYTES> text{};
             };
 
-            inline std::atomic<bool>& is_sync_logging_enabled()
+            /** @brief Copies a string argument into the record, cutting it if the text space is full. */
+            inline void encode_text(LogRecord& rec, std::string_view s)
             {
-                static std::atomic<bool> mode{false};
-                return mode;
+                size_t n = std::min(s.size(), LogRecord::TEXT_BYTES - rec.text_used);
+                std::memcpy(rec.text.data() + rec.text_used, s.data(), n);
+
+                rec.tags[rec.arg_count] = ArgTag::TEXT;
+                rec.slots[rec.arg_count] = (static_cast<uint64_t>(rec.text_used) << 32) | n;
+                rec.text_used = static_cast<uint16_t>(rec.text_used + n);
+            }
+
+            /**
+             * @brief Stores one argument in the record without formatting it.
+             * 
+             * Types that are not numbers, pointers or strings are formatted here with "{}".
+             */
+            template<typename T>
+            void encode_arg(LogRecord& rec, const T& value)
+            {
+                using D = std::remove_cvref_t<T>;
+                ArgTag& tag = rec.tags[rec.arg_count];
+                uint64_t& slot = rec.slots[rec.arg_count];
+
+                if constexpr (std::is_same_v<D, bool>) { tag = ArgTag::BOOL; slot = value; }
+                else if constexpr (std::is_same_v<D, char>) { tag = ArgTag::CHAR; slot = static_cast<unsigned char>(value); }
+                else if constexpr (std::is_integral_v<D> && std::is_signed_v<D>) { tag = ArgTag::INT; slot = std::bit_cast<uint64_t>(static_cast<int64_t>(value)); }
+                else if constexpr (std::is_integral_v<D>) { tag = ArgTag::UINT; slot = static_cast<uint64_t>(value); }
+                else if constexpr (std::is_floating_point_v<D>) { tag = ArgTag::FLOAT; slot = std::bit_cast<uint64_t>(static_cast<double>(value)); }
+                else if constexpr (std::is_convertible_v<const D&, std::string_view>) encode_text(rec, std::string_view(value));
+                else if constexpr (std::is_pointer_v<D>) { tag = ArgTag::PTR; slot = reinterpret_cast<uintptr_t>(value); }
+                else encode_text(rec, std::format("{}", value));
+
+                rec.arg_count++;
             }
 
-            inline void dispatch_log(LogType level, std::string&& msg) 
+            /** @brief A decoded log argument. */
+            using LogArg = std::variant<bool, char, int64_t, uint64_t, double, const void*, std::string_view>;
+
+            inline LogArg decode_arg(const LogRecord& rec, size_t i)
             {
-                if (is_sync_logging_enabled().load(std::memory_order_relaxed)) 
+                uint64_t slot = rec.slots[i];
+                switch (rec.tags[i])
                 {
-                    static SyncLogger sync_logger;
-                    sync_logger.enqueue(level, std::move(msg));
-                } 
-                else 
+                    case ArgTag::BOOL:  return slot != 0;
+                    case ArgTag::CHAR:  return static_cast<char>(slot);
+                    case ArgTag::INT:   return std::bit_cast<int64_t>(slot);
+                    case ArgTag::UINT:  return slot;
+                    case ArgTag::FLOAT: return std::bit_cast<double>(slot);
+                    case ArgTag::PTR:   return reinterpret_cast<const void*>(static_cast<uintptr_t>(slot));
+                    case ArgTag::TEXT:  return std::string_view(rec.text.data() + (slot >> 32), slot & 0xFFFFFFFFu);
+                }
+                return false;
+            }
+
+            /**
+             * @brief Formats the message of a record.
+             * 
+             * Each replacement field is formatted on its own with its stored argument, 
+             * so "{}", "{0}" and specs like "{:.3f}" work. Nested fields like "{:{}}" do not.
+             * @param rec The record to format.
+             * @return The message text.
+             * @throws std::format_error If the format string does not match the arguments.
+             */
+            inline std::string format_message(const LogRecord& rec)
+            {
+                std::string out;
+                std::string spec;
+                std::string_view f = rec.fmt;
+                size_t next = 0;
+
+                for (size_t i = 0; i < f.size(); ++i)
                 {
-                    static AsyncLogger async_logger;
-                    async_logger.enqueue(level, std::move(msg));
+                    char c = f[i];
+                    if ((c == '{' || c == '}') && i + 1 < f.size() && f[i + 1] == c)
+                    {
+                        out += c;
+                        ++i;
+                        continue;
+                    }
+                    if (c != '{')
+                    {
+                        out += c;
+                        continue;
+                    }
+
+                    size_t close = f.find('}', i);
+                    if (close == std::string_view::npos) throw std::format_error("Unmatched '{' in log format string");
+
+                    std::string_view field = f.substr(i + 1, close - i - 1);
+                    size_t colon = std::min(field.find(':'), field.size());
+
+                    size_t arg = 0;
+                    if (colon == 0) arg = next++;
+                    else for (char d : field.substr(0, colon)) arg = arg * 10 + static_cast<size_t>(d - '0');
+                    if (arg >= rec.arg_count) throw std::format_error("Log argument index out of range");
+
+                    spec.assign("{");
+                    spec.append(field.substr(colon));
+                    spec.append("}");
+                    std::visit([&](const auto& v) 
+                    { 
+                        std::vformat_to(std::back_inserter(out), spec, std::make_format_args(v)); 
+                    }, decode_arg(rec, arg));
+
+                    i = close;
                 }
+                return out;
             }
 
             /**
@@ -205,20 +339,27 @@ namespace SushiBLAS
                 #endif
             }
 
+            /** @brief Gets the current wall clock time in nanoseconds. */
+            inline uint64_t now_ns()
+            {
+                auto t = std::chrono::system_clock::now().time_since_epoch();
+                return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(t).count());
+            }
+
             /**
              * @brief Creates a timestamp with millisecond precision.
+             * @param time_ns Wall clock time in nanoseconds.
              * @return Formatted time string (HH:MM:SS.mmm).
              */
-            inline std::string get_timestamp() 
+            inline std::string get_timestamp(uint64_t time_ns) 
             {
-                auto now = std::chrono::system_clock::now();
-                auto time = std::chrono::system_clock::to_time_t(now);
+                std::time_t time = static_cast<std::time_t>(time_ns / 1000000000ull);
                 std::tm tm;
                 portable_localtime(&tm, &time);
                 
                 // add milliseconds for better tracking in async tasks
-                auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
-                return std::format("{:02}:{:02}:{:02}.{:03}", tm.tm_hour, tm.tm_min, tm.tm_sec, ms.count());
+                uint64_t ms = (time_ns / 1000000ull) % 1000;
+                return std::format("{:02}:{:02}:{:02}.{:03}", tm.tm_hour, tm.tm_min, tm.tm_sec, ms);
             }
 
             /**
@@ -231,24 +372,306 @@ namespace SushiBLAS
                 return sv;
             }
 
+            inline const char* level_name(LogType level)
+            {
+                switch (level)
+                {
+                    case LogType::ERR:   return "ERROR";
+                    case LogType::WARN:  return "WARN";
+                    case LogType::INFO:  return "INFO";
+                    case LogType::DEBUG: return "DEBUG";
+                    default:             return "OFF";
+                }
+            }
+
+            /** @brief Formats a record as one output line. */
+            inline std::string format_line(const LogRecord& rec)
+            {
+                try 
+                {
+                    return std::format("[{}] [{}] [{}] [{}:{}] [{}] {}\n", 
+                        get_timestamp(rec.time_ns), 
+                        level_name(rec.level), 
+                        CATEGORY_NAMES[static_cast<size_t>(rec.category)], 
+                        rec.loc.file_name(),
+                        rec.loc.line(),
+                        extract_function_name(rec.loc.function_name()), 
+                        format_message(rec));
+                } 
+                catch (const std::format_error& e) 
+                {
+                    return std::format("Log format error: {} ({}:{})\n", e.what(), rec.loc.file_name(), rec.loc.line());
+                }
+            }
+
+            inline void write_line(LogType level, const std::string& line, bool flush)
+            {
+                FILE* stream = (level <= LogType::ERR) ? stderr : stdout;
+                #ifdef _WIN32
+                    _lock_file(stream);
+                    fputs(line.c_str(), stream);
+                    if (flush) fflush(stream);
+                    _unlock_file(stream);
+                #else
+                    flockfile(stream);
+                    fputs(line.c_str(), stream);
+                    if (flush) fflush(stream);
+                    funlockfile(stream);
+                #endif
+            }
+
+            /**
+             * @brief A single-producer single-consumer ring of log records.
+             * 
+             * Each logging thread owns one ring, so pushing needs no lock. If the ring 
+             * is full the message is dropped and counted instead of blocking the caller.
+             */
+            class LogRing 
+            {
+                public:
+                    static constexpr uint64_t CAPACITY = 1024;
+
+                    LogRing() : records_(std::make_unique<LogRecord[]>(CAPACITY)) {}
+
+                    /** @brief Gets the next free record, or nullptr if the ring is full. */
+                    LogRecord* begin_push()
+                    {
+                        uint64_t tail = tail_.load(std::memory_order_relaxed);
+                        if (tail - head_.load(std::memory_order_acquire) == CAPACITY)
+                        {
+                            dropped.fetch_add(1, std::memory_order_relaxed);
+                            return nullptr;
+                        }
+                        return &records_[tail & (CAPACITY - 1)];
+                    }
+
+                    /** @brief Publishes the record returned by begin_push(). */
+                    void end_push()
+                    {
+                        tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+                    }
+
+                    /** @brief Gets the oldest record, or nullptr if the ring is empty. */
+                    const LogRecord* front() const
+                    {
+                        uint64_t head = head_.load(std::memory_order_relaxed);
+                        if (head == tail_.load(std::memory_order_acquire)) return nullptr;
+                        return &records_[head & (CAPACITY - 1)];
+                    }
+
+                    /** @brief Releases the record returned by front(). */
+                    void pop()
+                    {
+                        head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+                    }
+
+                    /** @brief Messages dropped because the ring was full. */
+                    std::atomic<uint64_t> dropped{0};
+
+                    /** @brief Set when the owning thread exits. */
+                    std::atomic<bool> closed{false};
+
+                private:
+                    // producer and consumer indices on separate cache lines
+                    alignas(64) std::atomic<uint64_t> head_{0};
+                    alignas(64) std::atomic<uint64_t> tail_{0};
+                    std::unique_ptr<LogRecord[]> records_;
+            };
+
+            /**
+             * @brief Prints the records of all thread rings on a background thread.
+             * 
+             * The worker merges the rings by time, formats the messages and writes them. 
+             * Logging threads only copy raw arguments into their ring.
+             */
+            class RingLogger 
+            {
+                private:
+                    std::mutex rings_mutex_;
+                    std::vector<std::shared_ptr<LogRing>> rings_;
+
+                    std::mutex drain_mutex_;
+                    std::vector<LogRecord> batch_;
+
+                    std::atomic<bool> running_;
+                    std::thread worker_;
+
+                    /** @brief Moves all records out of the rings and prints them. Returns the number printed. */
+                    size_t drain()
+                    {
+                        std::lock_guard<std::mutex> drain_lock(drain_mutex_);
+                        uint64_t dropped = 0;
+                        {
+                            std::lock_guard<std::mutex> lock(rings_mutex_);
+                            for (size_t i = 0; i < rings_.size();)
+                            {
+                                LogRing& ring = *rings_[i];
+                                bool closed = ring.closed.load(std::memory_order_acquire);
+
+                                while (const LogRecord* rec = ring.front())
+                                {
+                                    batch_.push_back(*rec);
+                                    ring.pop();
+                                }
+                                dropped += ring.dropped.exchange(0, std::memory_order_relaxed);
+
+                                // the owner is gone and everything it wrote is printed
+                                if (closed)
+                                {
+                                    rings_[i] = std::move(rings_.back());
+                                    rings_.pop_back();
+                                }
+                                else ++i;
+                            }
+                        }
+
+                        std::stable_sort(batch_.begin(), batch_.end(), [](const LogRecord& a, const LogRecord& b) 
+                        { 
+                            return a.time_ns < b.time_ns; 
+                        });
+
+                        for (const LogRecord& rec : batch_)
+                            write_line(rec.level, format_line(rec), false);
+
+                        if (dropped > 0)
+                            write_line(LogType::WARN, std::format("[{}] [WARN] [CORE] Log buffer full, dropped {} messages.\n", 
+                                get_timestamp(now_ns()), dropped), false);
+
+                        size_t count = batch_.size();
+                        if (count > 0 || dropped > 0)
+                        {
+                            fflush(stdout);
+                            fflush(stderr);
+                        }
+                        batch_.clear();
+                        return count;
+                    }
+
+                    void process_logs() 
+                    {
+                        while (running_.load(std::memory_order_relaxed)) 
+                        {
+                            // polling keeps the logging threads free of any notify call
+                            if (drain() == 0)
+                                std::this_thread::sleep_for(std::chrono::microseconds(500));
+                        }
+                    }
+
+                public:
+                    RingLogger() : running_(true) 
+                    {
+                        worker_ = std::thread(&RingLogger::process_logs, this);
+                    }
+
+                    ~RingLogger() 
+                    {
+                        running_.store(false, std::memory_order_relaxed);
+                        if (worker_.joinable()) 
+                        {
+                            worker_.join();
+                        }
+                        drain();
+                    }
+
+                    /** @brief Gets the ring of the calling thread, creating it on first use. */
+                    LogRing& local_ring()
+                    {
+                        struct Owner 
+                        {
+                            std::shared_ptr<LogRing> ring;
+                            ~Owner() { if (ring) ring->closed.store(true, std::memory_order_release); }
+                        };
+                        thread_local Owner owner;
+
+                        if (!owner.ring)
+                        {
+                            owner.ring = std::make_shared<LogRing>();
+                            std::lock_guard<std::mutex> lock(rings_mutex_);
+                            rings_.push_back(owner.ring);
+                        }
+                        return *owner.ring;
+                    }
+
+                    /** @brief Prints everything pushed so far before returning. */
+                    void flush() { drain(); }
+            };
+
+            class SyncLogger 
+            {
+                private:
+                    std::mutex sync_mutex_;
+                public:
+                    void enqueue(LogType level, std::string&& msg) 
+                    {
+                        std::lock_guard<std::mutex> lock(sync_mutex_);
+                        write_line(level, msg, true);
+                    }
+            };
+
+            inline std::atomic<bool>& is_sync_logging_enabled()
+            {
+                static std::atomic<bool> mode{false};
+                return mode;
+            }
+
+            inline RingLogger& ring_logger()
+            {
+                static RingLogger logger;
+                return logger;
+            }
+
             template<typename... Args>
-            void log_base(LogType level, std::string_view prefix, const std::source_location& loc, std::string_view fmt, Args&&... args) 
+            void fill_record(LogRecord& rec, LogType level, LogCategory category, const std::source_location& loc, std::string_view fmt, const Args&... args)
+            {
+                rec.time_ns = now_ns();
+                rec.level = level;
+                rec.category = category;
+                rec.loc = loc;
+                rec.arg_count = 0;
+                rec.text_used = 0;
+
+                if constexpr (sizeof...(Args) <= LogRecord::MAX_ARGS)
+                {
+                    rec.fmt = fmt;
+                    (encode_arg(rec, args), ...);
+                }
+                else
+                {
+                    // too many arguments to store, format them on this thread
+                    rec.fmt = "{}";
+                    encode_arg(rec, std::vformat(fmt, std::make_format_args(args...)));
+                }
+            }
+
+            /**
+             * @brief Logs a message of a category if its runtime level allows it.
+             * 
+             * The format string must be a string literal, since it is read later on 
+             * the logger thread.
+             */
+            template<LogCategory C, typename... Args>
+            void log_base(LogType level, const std::source_location& loc, std::string_view fmt, Args&&... args) 
             {
                 #if SB_ENABLE_LOGGING
+                    if (static_cast<int>(level) > log_levels()[static_cast<size_t>(C)].load(std::memory_order_relaxed)) return;
+
                     try 
                     {
-                        std::string msg = std::vformat(fmt, std::make_format_args(args...));
-                        std::string_view func_name = extract_function_name(loc.function_name());
-                        
-                        auto output = std::format("[{}] [{}] [{}:{}] [{}] {}\n", 
-                            get_timestamp(), 
-                            prefix, 
-                            loc.file_name(),
-                            loc.line(),
-                            func_name, 
-                            msg);
-                        
-                        dispatch_log(level, std::move(output));
+                        if (is_sync_logging_enabled().load(std::memory_order_relaxed)) 
+                        {
+                            static SyncLogger sync_logger;
+                            LogRecord rec;
+                            fill_record(rec, level, C, loc, fmt, args...);
+                            sync_logger.enqueue(level, format_line(rec));
+                            return;
+                        }
+
+                        LogRing& ring = ring_logger().local_ring();
+                        if (LogRecord* rec = ring.begin_push())
+                        {
+                            fill_record(*rec, level, C, loc, fmt, args...);
+                            ring.end_push();
+                        }
                     } 
                     catch (const std::format_error& e) 
                     {
@@ -257,7 +680,23 @@ namespace SushiBLAS
                 #endif
             }
         } // namespace Detail
+
+        /**
+         * @brief Prints all log messages pushed so far by the calling thread.
+         * 
+         * Messages are written by a background thread. Call this before reading 
+         * the output, e.g. before the program aborts.
+         */
+        inline void flush_logs()
+        {
+            if (!Detail::is_sync_logging_enabled().load(std::memory_order_relaxed))
+                Detail::ring_logger().flush();
+        }
     } // namespace Core
+
+    /** @brief The log category of the current source file. */
+    #define SB_LOG_CURRENT_CATEGORY \
+        SushiBLAS::Core::Detail::category_of(std::source_location::current().file_name())
     
     /**
      * @brief Logs a message at error level.
@@ -265,22 +704,22 @@ namespace SushiBLAS
     #if SB_ENABLE_LOGGING
         #define SB_LOG_ERROR(fmt, ...) \
             if constexpr (SushiBLAS::Core::ACTIVE_LOG_LEVEL >= SushiBLAS::Core::LogType::ERR) \
-                SushiBLAS::Core::Detail::log_base(SushiBLAS::Core::LogType::ERR, "ERROR", std::source_location::current(), fmt __VA_OPT__(,) __VA_ARGS__)
+                SushiBLAS::Core::Detail::log_base<SB_LOG_CURRENT_CATEGORY>(SushiBLAS::Core::LogType::ERR, std::source_location::current(), fmt __VA_OPT__(,) __VA_ARGS__)
 
         /** @brief Logs a message at warning level. */
         #define SB_LOG_WARN(fmt, ...) \
             if constexpr (SushiBLAS::Core::ACTIVE_LOG_LEVEL >= SushiBLAS::Core::LogType::WARN) \
-                SushiBLAS::Core::Detail::log_base(SushiBLAS::Core::LogType::WARN, "WARN", std::source_location::current(), fmt __VA_OPT__(,) __VA_ARGS__)
+                SushiBLAS::Core::Detail::log_base<SB_LOG_CURRENT_CATEGORY>(SushiBLAS::Core::LogType::WARN, std::source_location::current(), fmt __VA_OPT__(,) __VA_ARGS__)
 
         /** @brief Logs a message at info level. */
         #define SB_LOG_INFO(fmt, ...) \
             if constexpr (SushiBLAS::Core::ACTIVE_LOG_LEVEL >= SushiBLAS::Core::LogType::INFO) \
-                SushiBLAS::Core::Detail::log_base(SushiBLAS::Core::LogType::INFO, "INFO", std::source_location::current(), fmt __VA_OPT__(,) __VA_ARGS__)
+                SushiBLAS::Core::Detail::log_base<SB_LOG_CURRENT_CATEGORY>(SushiBLAS::Core::LogType::INFO, std::source_location::current(), fmt __VA_OPT__(,) __VA_ARGS__)
 
         /** @brief Logs a message at debug level. */
         #define SB_LOG_DEBUG(fmt, ...) \
             if constexpr (SushiBLAS::Core::ACTIVE_LOG_LEVEL >= SushiBLAS::Core::LogType::DEBUG) \
-                SushiBLAS::Core::Detail::log_base(SushiBLAS::Core::LogType::DEBUG, "DEBUG", std::source_location::current(), fmt __VA_OPT__(,) __VA_ARGS__)
+                SushiBLAS::Core::Detail::log_base<SB_LOG_CURRENT_CATEGORY>(SushiBLAS::Core::LogType::DEBUG, std::source_location::current(), fmt __VA_OPT__(,) __VA_ARGS__)
     #else
         #define SB_LOG_ERROR(fmt, ...) ((void)0)
         #define SB_LOG_WARN(fmt, ...)  ((void)0)
@@ -302,6 +741,7 @@ namespace SushiBLAS
             do { \
                 if (!(condition)) { \
                     SB_LOG_ERROR("Assertion failed: {} ({}:{})", msg, __FILE__, __LINE__); \
+                    SushiBLAS::Core::flush_logs(); \
                     std::abort(); \
                 } \
             } while (0)
@@ -322,4 +762,4 @@ namespace SushiBLAS
             } \
         } while (0)
 
-} // namespace SushiBLAS
\ No newline at end of file
+} // namespace SushiBLAS
@@ -30,26 +30,70 @@
 
 #pragma once
 
+#include <span>
+#include <deque>
 #include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <optional>
+#include <functional>
 #include <SushiBLAS/io.hpp>
 #include <SushiBLAS/tensor.hpp>
 #include <SushiBLAS/storage.hpp>
 #include <SushiBLAS/ops/blas.hpp>
 #include <SushiBLAS/core/common.hpp>
 #include <SushiBLAS/core/logger.hpp>
+#include <SushiBLAS/io/io_worker.hpp>
+#include <SushiBLAS/io/parallel_io.hpp>
+#include <SushiBLAS/graph/op_stats.hpp>
 #include <SushiRuntime/SushiRuntime.h>
+#include <SushiBLAS/graph/priority.hpp>
+#include <SushiBLAS/graph/profiler.hpp>
+#include <SushiBLAS/graph/placement.hpp>
 #include <SushiBLAS/ops/logic/logic.hpp>
 #include <SushiBLAS/ops/math/random.hpp>
 #include <SushiBLAS/ops/math/nonlinear.hpp>
 #include <SushiBLAS/ops/lapack/linalg.hpp>
 #include <SushiRuntime/graph/task_graph.hpp>
 #include <SushiBLAS/ops/math/reductions.hpp>
+#include <SushiBLAS/graph/range_tracker.hpp>
 #include <SushiBLAS/ops/math/elementwise.hpp>
 #include <SushiBLAS/ops/signal/transforms.hpp>
+#include <SushiBLAS/graph/memory_planner.hpp>
+#include <SushiBLAS/graph/executable_graph.hpp>
+#include <SushiBLAS/memory/caching_allocator.hpp>
 
 
 namespace SushiBLAS 
 {
+    template<typename Derived>
+    struct Expression;
+
+    /**
+     * @struct StreamingPolicy
+     * @brief Limits that make the engine send queued tasks without waiting for execute().
+     * 
+     * A limit of 0 is off. With all limits off, tasks only run on execute().
+     */
+    struct StreamingPolicy 
+    {
+        /** @brief Flush once this many tasks are queued. */
+        size_t max_tasks = 0;
+
+        /** @brief Flush once the queued tasks move this many bytes. */
+        size_t max_bytes = 0;
+
+        /** @brief Flush once the oldest queued task has waited this long. It is checked when a task is added. */
+        std::chrono::microseconds max_delay{0};
+
+        /** @brief Wait for the oldest running flush before sending more, once this many are running. */
+        size_t max_in_flight = 0;
+
+        /** @brief Check if any flush limit is set. */
+        inline bool enabled() const { return max_tasks > 0 || max_bytes > 0 || max_delay.count() > 0; }
+    };
+
     /**
      * @class Engine
      * @brief The core engine for high-performance mathematical operations.
@@ -61,6 +105,14 @@ namespace SushiBLAS
     class Engine 
     {
         public:
+            /** 
+             * @brief The most tasks one epoch holds. 
+             * 
+             * The runtime orders tasks of an epoch through one token each, and it has this 
+             * many distinct token slots. A longer queue is flushed early, like a streaming flush.
+             */
+            static constexpr size_t MAX_EPOCH_TASKS = 1024;
+
             /**
              * @brief Construct a new Engine.
              * @param ctx The SushiRuntime execution context.
@@ -69,6 +121,9 @@ namespace SushiBLAS
             Engine(SushiRuntime::Execution::RuntimeContext& ctx, 
                    Core::Layout layout = Core::Layout::ROW_MAJOR);
 
+            /** @brief Waits for in-flight epochs before their task memory is released. */
+            ~Engine();
+
             /** 
              * @brief Get the default memory layout. 
              * @return The current default layout (Row-Major or Column-Major).
@@ -87,6 +142,21 @@ namespace SushiBLAS
              */
             inline IO io() { return IO(*this); }
 
+            /** 
+             * @brief The background thread that runs the file work of async IO. 
+             * @return The IO worker of this engine.
+             */
+            inline IOWorker& io_worker() { return io_worker_; }
+
+            /** 
+             * @brief The chunked file transfers used by IO.
+             * 
+             * Use set_options() on it to change the chunk size, the number of threads 
+             * or to turn on direct IO.
+             * @return The ParallelIO of this engine.
+             */
+            inline ParallelIO& parallel_io() { return parallel_io_; }
+
             /** 
              * @brief Logical operations and boolean mask generation. 
              * @return A LogicOps object providing access to logical kernels.
@@ -129,6 +199,21 @@ namespace SushiBLAS
              */
             inline ElementwiseOps elementwise() { return ElementwiseOps(*this); }
 
+            /**
+             * @brief Evaluate a lazy elementwise expression into a tensor with one kernel.
+             * 
+             * The expression tree (see Expression in ops/math/expression.hpp) becomes a 
+             * single task. Its reads are the leaf tensors and its write is out, so each 
+             * input is read once and no temporaries are made. Leaves are broadcast to 
+             * the shape of out, and any of them can be a view.
+             * @param out The output tensor. A leaf may be out itself, but not a different view of it.
+             * @param expression The expression, e.g. `(A * B + C).exp()`.
+             * @return sycl::event.
+             * @throws std::runtime_error If a leaf cannot be broadcast to out or has another data type.
+             */
+            template<typename E>
+            sycl::event assign(Tensor& out, const Expression<E>& expression);
+
             /** 
              * @brief Get the underlying SushiRuntime execution context. 
              * @return Reference to the RuntimeContext.
@@ -143,9 +228,233 @@ namespace SushiBLAS
 
             /** 
              * @brief Execute all queued tasks in the graph. 
+             * 
+             * Queued tasks first go through the optimization passes (elementwise fusion), 
+             * then they are sent to the TaskGraph, or straight to the queue in 
+             * ExecutionMode::EVENT_DRIVEN.
              * @return A sycl::event that can be used to synchronize with graph completion.
              */
-            sycl::event execute() { return graph_.execute(); }
+            sycl::event execute();
+
+            /**
+             * @brief Select how execute() sends tasks to the device.
+             * 
+             * In EVENT_DRIVEN mode every task is submitted at once with the events of the 
+             * tasks it depends on. The device driver starts each task when its inputs are 
+             * ready, so no host thread polls events in between.
+             * @param mode The execution mode used by the next execute() calls.
+             */
+            void set_execution_mode(Core::ExecutionMode mode) { execution_mode_ = mode; }
+
+            /**
+             * @brief Enable or disable task profiling.
+             * 
+             * While enabled, every task sent by execute() records its host enqueue time, 
+             * the time its dependencies were met, the worker thread and its kernel start 
+             * and end. Tasks without a NUMA node or lane run on a profiling-enabled queue.
+             * Captured graphs are not profiled. Use profiler() to write the trace.
+             * @param enabled True to start recording.
+             */
+            void set_profiling_enabled(bool enabled);
+
+            /** 
+             * @brief Check if task profiling is enabled.
+             * @return True if execute() records task timing.
+             */
+            inline bool is_profiling_enabled() const { return profiling_enabled_; }
+
+            /** 
+             * @brief Access the recorded task timing.
+             * @return The profiler, e.g. to call write_chrome_trace().
+             */
+            inline Profiler& profiler() { return profiler_; }
+
+            /**
+             * @brief Enable or disable per-operation statistics.
+             * 
+             * While enabled, every task sent by execute() adds its latency, FLOPs and 
+             * bytes to the counters of its OpID. Like profiling, tasks without a NUMA 
+             * node or lane run on a profiling-enabled queue to get kernel times.
+             * @param enabled True to start counting.
+             */
+            void set_stats_enabled(bool enabled);
+
+            /** 
+             * @brief Check if per-operation statistics are enabled.
+             * @return True if execute() counts task statistics.
+             */
+            inline bool is_stats_enabled() const { return stats_enabled_; }
+
+            /** 
+             * @brief Access the per-operation statistics.
+             * @return The counters, e.g. to call snapshot().
+             */
+            inline OpStats& stats() { return stats_; }
+
+            /**
+             * @brief Split the device into several lanes, each with its own queue.
+             * 
+             * The device is partitioned by affinity domain, or into equal slices of 
+             * compute units if that is not supported. Independent branches of the task 
+             * graph are spread over the lanes, so they do not share one thread pool. 
+             * Tasks whose tensors have a NUMA node still run on that node's queue.
+             * @param lanes The wanted number of lanes. 0 or 1 runs everything on the main queue.
+             * @return The number of lanes in use. It is smaller than asked if the device has fewer partitions.
+             */
+            size_t set_lane_count(size_t lanes);
+
+            /** 
+             * @brief Get the number of lanes in use.
+             * @return 1 if the device is not partitioned.
+             */
+            inline size_t get_lane_count() const { return lane_queues_.empty() ? 1 : lane_queues_.size(); }
+
+            /**
+             * @brief Send queued tasks automatically when they cross a limit.
+             * 
+             * Each automatic flush works like execute(), so the device runs earlier tasks 
+             * while new ones are still added, and the queue can not grow without bound. 
+             * Flushes split fusion chains, so elementwise ops are only fused inside one flush. 
+             * The next execute() returns an event that also covers all automatic flushes.
+             * @param policy The limits. A default policy turns streaming off.
+             */
+            void set_streaming_policy(const StreamingPolicy& policy) { streaming_ = policy; }
+
+            /** 
+             * @brief Get the streaming limits.
+             * @return The policy set by set_streaming_policy().
+             */
+            inline const StreamingPolicy& get_streaming_policy() const { return streaming_; }
+
+            /** 
+             * @brief Get the number of queued tasks that were not sent yet.
+             * @return The tasks waiting for execute() or the next automatic flush.
+             */
+            inline size_t get_pending_count() const { return pending_tasks_.size(); }
+
+            /** 
+             * @brief Get the current execution mode.
+             * @return The mode used by execute(). SCHEDULED is the default.
+             */
+            inline Core::ExecutionMode get_execution_mode() const { return execution_mode_; }
+
+            /**
+             * @brief Add a task to the engine.
+             * 
+             * All operations use this function instead of calling the TaskGraph directly.
+             * The task is queued until execute(), or goes to the active capture if begin_capture() was called.
+             * 
+             * The access lists and the work closure are stored in the epoch arena, so 
+             * queuing a task does not allocate heap memory once the arena is warm.
+             * 
+             * @param meta The semantic metadata of the operation.
+             * @param read_access Byte ranges the task reads (see Tensor::access_range()).
+             * @param write_access Byte ranges the task writes.
+             * @param work The callable that submits the work, with the HostWork signature.
+             * @param fusion Optional description that lets elementwise tasks be fused.
+             * @param cost Optional work estimate used by stats().
+             */
+            template<typename Work>
+            void add_task(const SushiRuntime::Graph::TaskMetadata& meta,
+                          std::span<const AccessRange> read_access,
+                          std::span<const AccessRange> write_access,
+                          Work&& work,
+                          const FusionInfo& fusion = {},
+                          const OpCost& cost = {})
+            {
+                TaskArena& arena = capturing_ ? *capture_arena_ : *epoch_arena_;
+
+                TaskRecord rec;
+                rec.meta = meta;
+                rec.reads = arena.copy(read_access);
+                rec.writes = arena.copy(write_access);
+                rec.work = make_arena_work(arena, std::forward<Work>(work));
+                rec.fusion = fusion;
+                rec.cost = cost;
+
+                if (capturing_)
+                    captured_tasks_.push_back(std::move(rec));
+                else
+                {
+                    pending_tasks_.push_back(std::move(rec));
+                    if (streaming_.enabled() || pending_tasks_.size() >= MAX_EPOCH_TASKS) 
+                        stream_pending();
+                }
+            }
+
+            /**
+             * @brief Enable or disable the elementwise fusion pass.
+             * @param enabled True to merge chains of elementwise operations into single kernels.
+             */
+            void set_fusion_enabled(bool enabled) { fusion_enabled_ = enabled; }
+
+            /** 
+             * @brief Check if the elementwise fusion pass is enabled.
+             * @return True if fusion is enabled (default).
+             */
+            inline bool is_fusion_enabled() const { return fusion_enabled_; }
+
+            /**
+             * @brief Start recording tasks instead of sending them to the TaskGraph.
+             * 
+             * Tasks queued before this call are not part of the capture. Call execute() 
+             * first if the captured work depends on them.
+             * @throws std::runtime_error If a capture is already active.
+             */
+            void begin_capture();
+
+            /**
+             * @brief Stop recording and freeze the recorded tasks into a graph.
+             * @return An ExecutableGraph that can be launched many times.
+             * @throws std::runtime_error If no capture is active.
+             */
+            ExecutableGraph end_capture();
+
+            /** 
+             * @brief Check if the engine is recording tasks.
+             * @return True between begin_capture() and end_capture().
+             */
+            inline bool is_capturing() const { return capturing_; }
+
+            /**
+             * @brief Get the memory counters of the tensor allocators of this engine.
+             * 
+             * Tensors are allocated through a CachingAllocator, one per NUMA node in use. 
+             * The counters of all of them are added up.
+             * @return In-use, peak, cached and reserved bytes, and cache hits and misses.
+             */
+            MemoryStats memory_stats() const;
+
+            /**
+             * @brief Return cached tensor memory to the device.
+             * 
+             * Only blocks that no running epoch can still use are returned.
+             * @return The number of bytes returned.
+             */
+            size_t trim_memory();
+
+            /**
+             * @brief Capture a graph whose intermediate tensors share one memory arena.
+             * 
+             * The function is called twice. The first call is only recorded, to find 
+             * the tensors created inside it that the caller does not keep and the first 
+             * and last task that uses each of them. These intermediates get offsets in 
+             * one arena, so tensors that are never live at the same time share memory. 
+             * The second call is captured with the intermediates placed in the arena.
+             * 
+             * The function must create the same tensors in the same order on both calls.
+             * Tensors it keeps (e.g. by assigning them to outer variables) get their own memory.
+             * @param body The function that creates the tensors and queues the operations.
+             * @return An ExecutableGraph that can be launched many times.
+             * @throws std::runtime_error If a capture is already active or the two calls differ.
+             */
+            ExecutableGraph capture_planned(const std::function<void()>& body);
+
+            /** 
+             * @brief Get the plan made by the last capture_planned() call.
+             * @return The buffers with their lifetimes and offsets, and the memory saved.
+             */
+            inline const MemoryPlan& get_memory_plan() const { return memory_plan_; }
 
             /** 
              * @brief Create a new FLOAT32 tensor with the specified dimensions.
@@ -167,6 +476,22 @@ namespace SushiBLAS
                                  Core::DataType dtype,
                                  SushiRuntime::Memory::AllocStrategy strat = SushiRuntime::Memory::AllocStrategy::SHARED);
 
+            /** 
+             * @brief Create a new tensor whose memory lives on a NUMA node.
+             * 
+             * Tasks that touch tensors with a known node are submitted to the queue 
+             * of the node that holds most of their bytes.
+             * @param dims The dimensions of the tensor.
+             * @param dtype The data type of the tensor.
+             * @param numa_id The NUMA node to allocate on, or -1 for the default allocator.
+             * @param strat The allocation strategy (Shared, Device, or Host).
+             * @return A new Tensor object.
+             */
+            Tensor create_tensor_on_node(std::initializer_list<int64_t> dims, 
+                                         Core::DataType dtype,
+                                         int numa_id,
+                                         SushiRuntime::Memory::AllocStrategy strat = SushiRuntime::Memory::AllocStrategy::SHARED);
+
             /** 
              * @brief Set the seed for random number generation.
              * @param s The seed value.
@@ -191,6 +516,136 @@ namespace SushiBLAS
             Core::Layout default_layout_;
             uint64_t seed_ = 0;
             std::atomic<uint64_t> rng_offset_{0};
+
+            /** @brief An arena whose tasks were sent to the runtime, waiting for their epoch to finish. */
+            struct RetiredArena 
+            {
+                std::unique_ptr<TaskArena> arena;
+                sycl::event done;
+            };
+
+            /** @brief Get an arena for a new epoch, reusing a retired one if its epoch has finished. */
+            std::unique_ptr<TaskArena> acquire_arena();
+
+            friend class ExecutableGraph;
+
+            /** @brief Send the pending tasks to the device and start a new epoch. */
+            sycl::event flush_pending();
+
+            /** @brief Drop the epochs that finished, and their accesses, from the history. */
+            void retire_finished_epochs();
+
+            /** @brief Record the accesses of a submitted epoch and fence the allocators on it. */
+            void push_epoch(std::span<const TaskRecord> tasks, const sycl::event& done);
+
+            /**
+             * @brief Launch an executable graph as one epoch.
+             * 
+             * The launch waits for the running epochs it conflicts with, and its accesses 
+             * are recorded so later epochs and freed memory wait for it. Pending tasks 
+             * are executed first.
+             */
+            sycl::event launch_graph(ExecutableGraph& graph);
+
+            /** @brief Flush the pending tasks if they crossed a streaming limit. */
+            void stream_pending();
+
+            /** @brief Send the pending tasks to the runtime TaskGraph. */
+            sycl::event submit_scheduled();
+
+            /** @brief Submit the pending tasks to the queue, chained by their events. */
+            sycl::event submit_event_driven();
+
+            /** @brief Find the edges between the pending tasks and order them by critical path. */
+            void build_epoch_graph();
+
+            /** @brief Collect the done events of running epochs that a pending task conflicts with. */
+            void collect_history_deps(uint32_t task);
+
+            /** 
+             * @brief Bind tasks to the queue of their NUMA node, or else to the queue of their lane.
+             * 
+             * The edges of the tasks must be in epoch_pred_offsets_ and epoch_preds_.
+             */
+            void place_tasks(std::vector<TaskRecord>& tasks, TaskArena& arena);
+
+            /** @brief The two passes of capture_planned(), without the cleanup on failure. */
+            ExecutableGraph run_planned_capture(const std::function<void()>& body);
+
+            /** @brief Drop an unfinished capture and any planning state, so the engine can record normally again. */
+            void abort_capture();
+
+            /** @brief Get the caching allocator of a NUMA node, or of the default allocator for -1. */
+            SushiRuntime::sushi_ptr<CachingAllocator> tensor_allocator(int numa_id);
+
+            /** @brief Get the queue for tasks whose data lives on a NUMA node. It has profiling if stats or the profiler are on. */
+            sycl::queue& numa_queue(int node);
+
+            /** @brief Create or drop the profiling queue and rebuild the lanes after profiling or stats changed. */
+            void update_profiling_queues();
+
+            Core::ExecutionMode execution_mode_ = Core::ExecutionMode::SCHEDULED;
+
+            StreamingPolicy streaming_;
+            uint64_t pending_bytes_ = 0;
+            std::chrono::steady_clock::time_point pending_since_;
+            bool streamed_ = false;
+
+            bool fusion_enabled_ = true;
+            std::unique_ptr<TaskArena> epoch_arena_;
+            std::vector<RetiredArena> retired_arenas_;
+            std::vector<TaskRecord> pending_tasks_;
+            std::vector<void*> flush_reads_;
+            std::vector<void*> flush_writes_;
+
+            // The runtime tracks whole pointers, so ranges are resolved here. Each task 
+            // gets a token address and the runtime only sees edges between tokens.
+            std::vector<std::byte> tokens_;
+            size_t next_token_ = 0;
+            std::vector<void*> task_tokens_;
+            std::vector<uint32_t> flush_preds_;
+            std::vector<uint32_t> flush_order_;
+            std::vector<uint32_t> epoch_pred_offsets_;
+            std::vector<uint32_t> epoch_preds_;
+            std::vector<sycl::event> flush_deps_;
+            std::vector<sycl::event> task_events_;
+            std::vector<uint8_t> has_successor_;
+            RangeTracker epoch_tracker_;
+
+            // Accesses of earlier epochs still running, keyed by epoch number.
+            RangeTracker history_;
+            std::deque<sycl::event> epoch_events_;
+            uint32_t first_epoch_ = 0;
+
+            SushiRuntime::Topology::NUMAMapper numa_mapper_;
+            std::vector<std::optional<sycl::queue>> numa_queues_;
+            std::vector<sycl::queue> lane_queues_;
+
+            bool profiling_enabled_ = false;
+            Profiler profiler_;
+            bool stats_enabled_ = false;
+            OpStats stats_;
+            std::optional<sycl::queue> profiling_queue_;
+            std::vector<uint32_t> task_lanes_;
+
+            bool capturing_ = false;
+            std::unique_ptr<TaskArena> capture_arena_;
+            std::vector<TaskRecord> captured_tasks_;
+            std::vector<SushiRuntime::sushi_ptr<Storage>> captured_storages_;
+
+            // index 0 caches the default allocator, index n + 1 the allocator of NUMA node n
+            std::vector<SushiRuntime::sushi_ptr<CachingAllocator>> tensor_allocators_;
+
+            // arena views handed out in creation order during the second pass of capture_planned()
+            bool planning_ = false;
+            size_t plan_next_ = 0;
+            std::vector<SushiRuntime::sushi_ptr<Storage>> plan_storages_;
+            MemoryPlan memory_plan_;
+
+            ParallelIO parallel_io_;
+
+            // last, so pending file jobs finish before anything they use is destroyed
+            IOWorker io_worker_;
     };
 
 } // namespace SushiBLAS
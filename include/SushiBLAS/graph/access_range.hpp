@@ -0,0 +1,88 @@
+/**************************************************************************/
+/* access_range.hpp                                                       */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace SushiBLAS 
+{
+    /**
+     * @struct AccessRange
+     * @brief A byte range of one allocation that a task reads or writes.
+     * 
+     * Two ranges conflict only if they belong to the same allocation and their 
+     * bytes overlap. So tasks on disjoint slices of one big buffer do not wait 
+     * for each other.
+     */
+    struct AccessRange 
+    {
+        /** @brief Start of the allocation (Storage::alloc_base). It identifies the allocation. */
+        void* base = nullptr;
+
+        /** @brief First byte, relative to base. */
+        size_t begin = 0;
+
+        /** @brief One past the last byte, relative to base. */
+        size_t end = SIZE_MAX;
+
+        /** @brief The NUMA node that holds the allocation, or -1 if it is not known. */
+        int32_t numa_node = -1;
+
+        AccessRange() = default;
+
+        /** @brief A range that covers the whole allocation. */
+        AccessRange(void* ptr) : base(ptr) {}
+
+        /** @brief A range that covers [begin, end) of the allocation. */
+        AccessRange(void* ptr, size_t first, size_t last, int32_t numa = -1) 
+            : base(ptr), begin(first), end(last), numa_node(numa) {}
+
+        /** @brief Get the number of bytes, or 0 if the range covers a whole allocation of unknown size. */
+        inline size_t bytes() const { return (end == SIZE_MAX || begin >= end) ? 0 : end - begin; }
+
+        /** @brief Check if the range covers no bytes. */
+        inline bool empty() const { return base == nullptr || begin >= end; }
+
+        /** @brief Check if two ranges share at least one byte. */
+        inline bool overlaps(const AccessRange& other) const 
+        {
+            return base == other.base && begin < other.end && other.begin < end && !empty() && !other.empty();
+        }
+
+        /** @brief Check if this range contains every byte of the other range. */
+        inline bool covers(const AccessRange& other) const 
+        {
+            return base == other.base && begin <= other.begin && other.end <= end;
+        }
+    };
+
+} // namespace SushiBLAS
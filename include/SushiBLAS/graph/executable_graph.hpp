@@ -0,0 +1,150 @@
+/**************************************************************************/
+/* executable_graph.hpp                                                   */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include <span>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <sycl/sycl.hpp>
+#include <SushiBLAS/storage.hpp>
+#include <SushiBLAS/graph/task_record.hpp>
+
+namespace SushiBLAS 
+{
+    class Engine;
+
+    /**
+     * @class ExecutableGraph
+     * @brief A frozen task graph that can be launched many times.
+     * 
+     * The graph is created by Engine::end_capture(). All dependency edges are 
+     * resolved once when the graph is built. A launch only submits the recorded 
+     * work to the queue, so the host cost per step is very small.
+     * 
+     * Tensors used during the capture must stay alive while the graph is used.
+     * Tensors created during the capture are kept alive by the graph itself.
+     * The engine that captured the graph must outlive it.
+     */
+    class ExecutableGraph 
+    {
+        public:
+            /** @brief Create an empty graph. Launching it does nothing. */
+            ExecutableGraph() = default;
+
+            /**
+             * @brief Build a graph from recorded tasks.
+             * @param queue The queue used to submit the work.
+             * @param records The tasks in the order they were recorded.
+             * @param keep_alive Storages that must live as long as the graph.
+             * @param arena The arena that owns the access lists and closures of the records.
+             * @param engine The engine that orders launches with its other work, or nullptr.
+             */
+            ExecutableGraph(sycl::queue& queue, 
+                            std::vector<TaskRecord> records, 
+                            std::vector<SushiRuntime::sushi_ptr<Storage>> keep_alive = {},
+                            std::unique_ptr<TaskArena> arena = nullptr,
+                            Engine* engine = nullptr);
+
+            /** @brief Wait for the last launch, so the kept storages are not reused while it runs. */
+            ~ExecutableGraph();
+
+            ExecutableGraph(ExecutableGraph&&) = default;
+            ExecutableGraph& operator=(ExecutableGraph&& other);
+
+            ExecutableGraph(const ExecutableGraph&) = delete;
+            ExecutableGraph& operator=(const ExecutableGraph&) = delete;
+
+            /**
+             * @brief Submit all recorded tasks to the queue.
+             * 
+             * A launch waits for the previous launch of the same graph, so 
+             * launches never overlap on the same tensors. It is also ordered with the 
+             * engine's other work: it waits for running epochs that touch the same 
+             * memory, tasks queued before it are executed first, and later work on 
+             * its tensors waits for it.
+             * @return A sycl::event that completes when every task has finished.
+             */
+            sycl::event launch();
+
+            /** @brief Get the number of tasks in the graph. */
+            inline size_t size() const { return records_.size(); }
+
+            /** @brief Get the number of dependency edges in the graph. */
+            inline size_t num_edges() const { return preds_.size(); }
+
+            /** 
+             * @brief Get the order in which launch() submits the tasks.
+             * @return Task ids in recording order numbering, longest remaining path first.
+             */
+            inline std::span<const uint32_t> submission_order() const { return order_; }
+
+            /** @brief Check if the graph has no tasks. */
+            inline bool empty() const { return records_.empty(); }
+
+        private:
+            friend class Engine;
+
+            /** @brief Finds read/write conflicts between tasks and stores them as edges. */
+            void build_dependencies();
+
+            /**
+             * @brief Submit the recorded tasks after the previous launch and the given events.
+             * @param deps Events the root tasks wait for, on top of the previous launch.
+             */
+            sycl::event submit(const std::vector<sycl::event>& deps);
+
+            sycl::queue* queue_ = nullptr;
+            Engine* engine_ = nullptr;
+            std::unique_ptr<TaskArena> arena_;
+            std::vector<TaskRecord> records_;
+            std::vector<SushiRuntime::sushi_ptr<Storage>> keep_alive_;
+
+            /** @brief Predecessor lists in CSR form: preds_[pred_offsets_[i] .. pred_offsets_[i + 1]). */
+            std::vector<uint32_t> pred_offsets_;
+            std::vector<uint32_t> preds_;
+
+            /** @brief Task ids in submission order, see priority_order(). */
+            std::vector<uint32_t> order_;
+
+            /** @brief Tasks that no other task depends on. */
+            std::vector<uint32_t> sinks_;
+
+            /** @brief Scratch buffers reused by every launch. */
+            std::vector<sycl::event> events_;
+            std::vector<sycl::event> deps_;
+            std::vector<sycl::event> sink_events_;
+
+            /** @brief Completion event of the previous launch. */
+            sycl::event last_launch_;
+    };
+
+} // namespace SushiBLAS
@@ -0,0 +1,110 @@
+/**************************************************************************/
+/* fusion.hpp                                                             */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <SushiBLAS/core/common.hpp>
+
+namespace SushiBLAS 
+{
+    struct TaskRecord;
+    class TaskArena;
+
+    /**
+     * @struct FusionInfo
+     * @brief Describes an elementwise task so the fusion pass can merge it with its neighbours.
+     * 
+     * Only the elementwise and nonlinear helpers fill this in. A task with 
+     * `enabled == false` is never touched by the pass.
+     */
+    struct FusionInfo 
+    {
+        /** @brief True if the task can take part in a fused kernel. */
+        bool enabled = false;
+
+        /** @brief The memory the task writes (the whole storage). */
+        void* out = nullptr;
+
+        /** @brief First input of a binary task, nullptr for in-place unary tasks. */
+        void* lhs = nullptr;
+
+        /** @brief Second input of a binary task, nullptr for in-place unary tasks. */
+        void* rhs = nullptr;
+
+        /** @brief Number of elements the task touches. */
+        int64_t size = 0;
+
+        /** @brief Element type of all operands. */
+        Core::DataType dtype = Core::DataType::FLOAT32;
+    };
+
+    /**
+     * @brief Build the fusion description of an elementwise task.
+     * @param out The memory the task writes.
+     * @param lhs First input of a binary task, nullptr for in-place unary tasks.
+     * @param rhs Second input of a binary task, nullptr for in-place unary tasks.
+     * @param size Number of elements.
+     * @param dtype Element type. Complex types are never fused.
+     * @return The filled FusionInfo.
+     */
+    inline FusionInfo make_fusion_info(void* out, void* lhs, void* rhs, int64_t size, Core::DataType dtype)
+    {
+        FusionInfo info;
+        info.enabled = out != nullptr && size > 0 &&
+                       (dtype == Core::DataType::HALF || dtype == Core::DataType::FLOAT32 || dtype == Core::DataType::FLOAT64);
+        info.out = out;
+        info.lhs = lhs;
+        info.rhs = rhs;
+        info.size = size;
+        info.dtype = dtype;
+        return info;
+    }
+
+    /** @brief Maximum number of operations merged into one fused kernel. */
+    inline constexpr size_t MAX_FUSED_OPS = 8;
+
+    /**
+     * @brief Merge chains of elementwise tasks on the same memory into single kernels.
+     * 
+     * A chain starts with an elementwise task (binary or in-place unary) and 
+     * continues with the in-place unary tasks that next touch the same memory, 
+     * e.g. `add -> relu -> clamp`. The whole chain becomes one task that reads 
+     * the inputs once, applies every step in registers, and writes the result once.
+     * Tasks that do not touch the chain's memory keep their relative order.
+     * 
+     * @param tasks The pending tasks in submission order. Updated in place.
+     * @param arena The arena that owns the tasks. Fused kernels are stored in it too.
+     * @return The number of tasks removed by fusion.
+     */
+    size_t fuse_elementwise(std::vector<TaskRecord>& tasks, TaskArena& arena);
+
+} // namespace SushiBLAS
@@ -0,0 +1,101 @@
+/**************************************************************************/
+/* memory_planner.hpp                                                     */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include <span>
+#include <vector>
+#include <cstdint>
+
+namespace SushiBLAS 
+{
+    struct TaskRecord;
+
+    /**
+     * @struct PlannedBuffer
+     * @brief One tensor allocation seen by the memory planner.
+     */
+    struct PlannedBuffer 
+    {
+        /** @brief The allocation start that its access ranges use, or null to leave it out of the plan. */
+        void* base = nullptr;
+
+        /** @brief Size of the allocation in bytes. */
+        size_t bytes = 0;
+
+        /** @brief First and last task that touch the buffer, in recording order. */
+        uint32_t first = UINT32_MAX;
+        uint32_t last = 0;
+
+        /** @brief Byte offset inside the arena, valid if `planned` is true. */
+        size_t offset = 0;
+
+        /** @brief True if the buffer was given an offset in the arena. */
+        bool planned = false;
+    };
+
+    /**
+     * @struct MemoryPlan
+     * @brief The result of planning the intermediate tensors of a captured graph.
+     */
+    struct MemoryPlan 
+    {
+        /** @brief All tensors created during the capture, in creation order. */
+        std::vector<PlannedBuffer> buffers;
+
+        /** @brief Sum of the sizes of the planned buffers, the memory needed without the plan. */
+        size_t naive_bytes = 0;
+
+        /** @brief Size of the arenas holding the planned buffers. */
+        size_t arena_bytes = 0;
+    };
+
+    /**
+     * @brief Find the first and last task that touches each buffer.
+     * 
+     * A task touches a buffer if one of its read or write ranges has the buffer's base.
+     * @param tasks The tasks in recording order.
+     * @param buffers The buffers to update. Buffers with a null base are skipped.
+     */
+    void compute_lifetimes(std::span<const TaskRecord> tasks, std::span<PlannedBuffer> buffers);
+
+    /**
+     * @brief Give buffers offsets in one arena, so buffers that are live at the same time never overlap.
+     * 
+     * Buffers are placed from largest to smallest. Each one goes into the smallest 
+     * gap left by the already placed buffers whose lifetimes overlap its own, or on 
+     * top of them. Buffers with a null base or no using task are not planned.
+     * @param buffers The buffers to place.
+     * @param alignment The alignment of every offset.
+     * @return The size of the arena in bytes.
+     */
+    size_t assign_offsets(std::span<PlannedBuffer> buffers, size_t alignment);
+
+} // namespace SushiBLAS
@@ -0,0 +1,152 @@
+/**************************************************************************/
+/* op_stats.hpp                                                           */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include <span>
+#include <array>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+#include <sycl/sycl.hpp>
+
+namespace SushiBLAS 
+{
+    struct TaskRecord;
+    class TaskArena;
+
+    /**
+     * @struct OpStatsEntry
+     * @brief Aggregated counters of one operation type.
+     */
+    struct OpStatsEntry 
+    {
+        /** @brief The task name of the operation, e.g. "blas.lvl3.gemm". */
+        std::string name;
+
+        /** @brief The OpID value the entry is keyed by. */
+        uint64_t op_id = 0;
+
+        /** @brief Number of finished calls. */
+        uint64_t calls = 0;
+
+        /** @brief Sum of all call latencies in milliseconds. */
+        double total_ms = 0.0;
+
+        /** @brief Latency percentiles over the most recent calls. */
+        double p50_ms = 0.0;
+        double p95_ms = 0.0;
+        double p99_ms = 0.0;
+
+        /** @brief Estimated floating point operations and bytes moved by all calls. */
+        uint64_t flops = 0;
+        uint64_t bytes = 0;
+
+        /** @brief Achieved throughput over total_ms. */
+        double gflops = 0.0;
+        double gbps = 0.0;
+    };
+
+    /**
+     * @class OpStats
+     * @brief Collects call count, latency, FLOPs and bytes per operation type.
+     * 
+     * FLOPs and bytes come from the OpCost each operation gives to add_task. 
+     * Operations without a cost count the bytes of their tensor ranges and no FLOPs.
+     * Latency is the kernel time if the queue has profiling, else the host submit time.
+     * The kernel time runs from the first kernel of a task to its last (see mark_first_kernel).
+     */
+    class OpStats 
+    {
+        public:
+            /** @brief Number of recent latencies kept per operation for the percentiles. */
+            static constexpr size_t WINDOW = 1024;
+
+            /**
+             * @brief Wrap the work of tasks so their latency is recorded when they run.
+             * @param tasks The tasks that are about to be submitted.
+             * @param arena The arena that owns the new closures.
+             */
+            void instrument(std::span<TaskRecord> tasks, TaskArena& arena);
+
+            /**
+             * @brief Move finished calls into the counters.
+             * 
+             * Does not wait. Calls still running are counted by a later collect().
+             */
+            void collect();
+
+            /**
+             * @brief Get the counters of all operations seen so far.
+             * 
+             * Calls collect() first. Entries are sorted by total time, largest first.
+             * @return A copy of the counters, safe to export while tasks keep running.
+             */
+            std::vector<OpStatsEntry> snapshot();
+
+            /** @brief Drop all counters. Calls still running are not counted either. */
+            void reset();
+
+        private:
+            /** @brief One call that may still be running. */
+            struct Sample 
+            {
+                uint64_t op_id = 0;
+                const char* name = nullptr;
+                uint64_t flops = 0;
+                uint64_t bytes = 0;
+                uint64_t host_ns = 0;
+                sycl::event first;
+                sycl::event done;
+                std::atomic<bool> submitted{false};
+            };
+
+            /** @brief Counters of one operation. */
+            struct Aggregate 
+            {
+                OpStatsEntry entry;
+                std::array<double, WINDOW> recent{};
+                size_t recent_count = 0;
+            };
+
+            void add(const Sample& s, double ms);
+
+            // a deque keeps element addresses stable, so running tasks can write to their sample
+            std::deque<Sample> in_flight_;
+            std::unordered_map<uint64_t, Aggregate> ops_;
+            size_t skip_ = 0;
+            std::mutex mutex_;
+    };
+
+} // namespace SushiBLAS
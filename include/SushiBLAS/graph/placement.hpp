@@ -0,0 +1,72 @@
+/**************************************************************************/
+/* placement.hpp                                                          */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include <span>
+#include <vector>
+#include <cstdint>
+#include <SushiRuntime/topology/numa_mapper.hpp>
+
+namespace SushiBLAS 
+{
+    struct TaskRecord;
+
+    /**
+     * @brief Find the NUMA node a task should run on.
+     * 
+     * Every byte the task reads or writes is weighted by the distance from a 
+     * candidate node to the node that holds it. The node with the lowest total 
+     * wins, which is the node that holds most of the bytes when distances are equal.
+     * @param rec The task.
+     * @param mapper Distances between NUMA nodes.
+     * @return The chosen node, or -1 if none of the operands has a known node.
+     */
+    int home_numa_node(const TaskRecord& rec, const SushiRuntime::Topology::NUMAMapper& mapper);
+
+    /**
+     * @brief Spread independent branches of a task graph over several lanes.
+     * 
+     * A task with predecessors stays on the lane of its first predecessor, so a 
+     * chain never hops between queues. A task without predecessors starts a new 
+     * branch on the lane with the least estimated work so far.
+     * @param tasks The tasks in recording order.
+     * @param pred_offsets Start of the predecessor list of each task in preds, plus one end entry.
+     * @param preds Predecessor ids of all tasks.
+     * @param lane_count Number of lanes. With one lane every task gets lane 0.
+     * @param lanes Receives the lane of each task.
+     */
+    void assign_lanes(std::span<const TaskRecord> tasks, 
+                      std::span<const uint32_t> pred_offsets, 
+                      std::span<const uint32_t> preds, 
+                      size_t lane_count, 
+                      std::vector<uint32_t>& lanes);
+
+} // namespace SushiBLAS
@@ -0,0 +1,70 @@
+/**************************************************************************/
+/* priority.hpp                                                           */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include <span>
+#include <vector>
+#include <cstdint>
+
+namespace SushiBLAS 
+{
+    struct TaskRecord;
+
+    /**
+     * @brief Estimate the relative run time of a task.
+     * 
+     * The estimate comes from the OpCost the operation recorded: the larger of its 
+     * memory traffic and its flops scaled by a fixed machine balance. If the task has 
+     * no recorded bytes, the size of its access ranges is used instead. It is only 
+     * used to compare tasks, so the unit does not matter.
+     * @param rec The task.
+     * @return The estimated cost. Always greater than zero.
+     */
+    double estimate_cost(const TaskRecord& rec);
+
+    /**
+     * @brief Compute the submission order of a task graph from the critical path.
+     * 
+     * Every task gets an upward rank: its own cost plus the largest rank of its 
+     * successors. Ready tasks are then taken highest rank first, so the longest 
+     * chain starts as early as possible and short side tasks fill the gaps.
+     * The order always respects the dependency edges.
+     * @param tasks The tasks in recording order.
+     * @param pred_offsets Start of the predecessor list of each task in preds, plus one end entry.
+     * @param preds Predecessor ids of all tasks, each lower than the task id.
+     * @param order Receives the task ids in submission order.
+     */
+    void priority_order(std::span<const TaskRecord> tasks, 
+                        std::span<const uint32_t> pred_offsets, 
+                        std::span<const uint32_t> preds, 
+                        std::vector<uint32_t>& order);
+
+} // namespace SushiBLAS
@@ -0,0 +1,177 @@
+/**************************************************************************/
+/* profiler.hpp                                                           */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include <span>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <cstdint>
+#include <optional>
+#include <sycl/sycl.hpp>
+#include <SushiRuntime/graph/task_types.hpp>
+
+namespace SushiBLAS 
+{
+    struct TaskRecord;
+    class TaskArena;
+
+    /**
+     * @struct TaskTrace
+     * @brief Timing of one executed task.
+     * 
+     * Host times are nanoseconds of std::chrono::steady_clock. Kernel times come 
+     * from SYCL event profiling and are only valid if `has_kernel_time` is true.
+     */
+    struct TaskTrace 
+    {
+        /** @brief The metadata of the task (name, op_id and params). */
+        SushiRuntime::Graph::TaskMetadata meta;
+
+        /** @brief When execute() handed the task over. */
+        uint64_t enqueue_ns = 0;
+
+        /** @brief When all dependencies were met and the work was called. */
+        uint64_t ready_ns = 0;
+
+        /** @brief When the work returned after submitting its kernels. */
+        uint64_t submitted_ns = 0;
+
+        /** @brief Set by the task after it wrote its host fields, so readers see them complete. */
+        std::atomic<bool> submitted{false};
+
+        /** @brief Kernel start and end, moved to the host clock. */
+        uint64_t kernel_start_ns = 0;
+        uint64_t kernel_end_ns = 0;
+        bool has_kernel_time = false;
+
+        /** @brief The thread that called the work. */
+        std::thread::id thread;
+
+        /** @brief The queue the work was submitted to. Copies of one queue compare equal. */
+        std::optional<sycl::queue> queue;
+
+        /** @brief The first kernel of the task. The same as done unless the task submits several. */
+        sycl::event first;
+
+        /** @brief The event returned by the work. */
+        sycl::event done;
+    };
+
+    /**
+     * @brief Report the first kernel of a task that submits more than one.
+     * 
+     * A task's work only returns its last event. Instrumented tasks use the event 
+     * given here as the start of the task, so the time of earlier kernels is counted.
+     * Does nothing if no KernelSpan is open on this thread.
+     * @param e The event of the task's first kernel.
+     */
+    void mark_first_kernel(const sycl::event& e);
+
+    /**
+     * @class KernelSpan
+     * @brief Collects the first kernel reported while a task's work runs on this thread.
+     * 
+     * Spans nest, so the Profiler and OpStats can both wrap the same task.
+     */
+    class KernelSpan 
+    {
+        public:
+            KernelSpan();
+            ~KernelSpan();
+
+            KernelSpan(const KernelSpan&) = delete;
+            KernelSpan& operator=(const KernelSpan&) = delete;
+
+            /** @brief Get the first reported kernel, or `last` if none was reported. */
+            sycl::event first(const sycl::event& last) const { return has_first_ ? first_ : last; }
+
+        private:
+            friend void mark_first_kernel(const sycl::event& e);
+
+            KernelSpan* outer_ = nullptr;
+            sycl::event first_;
+            bool has_first_ = false;
+    };
+
+    /**
+     * @class Profiler
+     * @brief Records the timing of every executed task and writes it as a Chrome trace.
+     * 
+     * The trace opens in chrome://tracing or ui.perfetto.dev. Each worker thread 
+     * shows when tasks waited for their dependencies and how long submission took. 
+     * Each queue shows when the kernels ran, so scheduler gaps are visible next to 
+     * kernel time.
+     */
+    class Profiler 
+    {
+        public:
+            /**
+             * @brief Wrap the work of tasks so their timing is recorded when they run.
+             * @param tasks The tasks that are about to be submitted.
+             * @param arena The arena that owns the new closures.
+             */
+            void instrument(std::span<TaskRecord> tasks, TaskArena& arena);
+
+            /**
+             * @brief Write all recorded tasks as a Chrome trace JSON file.
+             * 
+             * Waits for the recorded tasks to finish first.
+             * @param path The output file.
+             * @throws std::runtime_error If the file can not be opened.
+             */
+            void write_chrome_trace(const std::string& path);
+
+            /** 
+             * @brief Remove all recorded tasks.
+             * 
+             * Running tasks write into their entry, so wait for them before clearing.
+             */
+            void clear();
+
+            /** @brief Get the number of recorded tasks. */
+            size_t size() const;
+
+            /** @brief Get the current time of the host clock used in the traces. */
+            static uint64_t now_ns();
+
+        private:
+            /** @brief Read the kernel times of finished tasks. */
+            void resolve_kernel_times();
+
+            // a deque keeps element addresses stable, so running tasks can write to their entry
+            std::deque<TaskTrace> traces_;
+            mutable std::mutex mutex_;
+    };
+
+} // namespace SushiBLAS
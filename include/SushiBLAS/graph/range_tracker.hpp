@@ -0,0 +1,146 @@
+/**************************************************************************/
+/* range_tracker.hpp                                                      */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include <span>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+#include <SushiBLAS/graph/access_range.hpp>
+
+namespace SushiBLAS 
+{
+    struct TaskRecord;
+
+    /**
+     * @class RangeTracker
+     * @brief Finds read/write conflicts between tasks using byte ranges.
+     * 
+     * Each allocation has its own list of recorded accesses, so two different 
+     * buffers never conflict. Inside one allocation only overlapping ranges 
+     * create an edge. An access that is fully covered by a later write is removed, 
+     * because the later write already orders everything after it.
+     * 
+     * The accesses of an allocation are sorted by their first byte. A lookup starts 
+     * at the first access that can still reach the range (using the longest access 
+     * of the allocation) and stops at the end of the range, so many slices of one 
+     * large buffer do not make every lookup scan every slice.
+     */
+    class RangeTracker 
+    {
+        public:
+            /**
+             * @brief Record the accesses of a task and collect the earlier tasks it must wait for.
+             * 
+             * Tasks must be recorded in submission order.
+             * @param task Id of the task.
+             * @param reads Ranges the task reads.
+             * @param writes Ranges the task writes.
+             * @param preds Ids of conflicting earlier tasks are appended here. The list can have duplicates.
+             */
+            void record(uint32_t task, 
+                        std::span<const AccessRange> reads, 
+                        std::span<const AccessRange> writes, 
+                        std::vector<uint32_t>& preds);
+
+            /**
+             * @brief Collect the recorded tasks that conflict with the given accesses, without recording them.
+             * @param reads Ranges that are read.
+             * @param writes Ranges that are written.
+             * @param preds Ids of conflicting tasks are appended here. The list can have duplicates.
+             */
+            void collect(std::span<const AccessRange> reads, 
+                         std::span<const AccessRange> writes, 
+                         std::vector<uint32_t>& preds) const;
+
+            /**
+             * @brief Record the accesses of a task without looking for conflicts.
+             * @param task Id of the task.
+             * @param reads Ranges the task reads.
+             * @param writes Ranges the task writes.
+             */
+            void insert(uint32_t task, 
+                        std::span<const AccessRange> reads, 
+                        std::span<const AccessRange> writes);
+
+            /**
+             * @brief Remove all accesses of tasks with an id lower than the given one.
+             * @param task The first id to keep.
+             */
+            void erase_before(uint32_t task);
+
+            /** @brief Remove all recorded accesses. */
+            void clear();
+
+            /** @brief Check if nothing is recorded. */
+            inline bool empty() const { return allocations_.empty(); }
+
+        private:
+            struct Access 
+            {
+                size_t begin;
+                size_t end;
+                uint32_t task;
+                bool is_write;
+            };
+
+            struct Allocation 
+            {
+                // sorted by begin
+                std::vector<Access> accesses;
+
+                // no access is longer than this, so a lookup for [b, e) can start at begin > b - max_bytes
+                size_t max_bytes = 0;
+            };
+
+            /** @brief Call fn for every access of the allocation that overlaps [begin, end). */
+            template<typename Fn>
+            static void for_overlapping(const Allocation& alloc, size_t begin, size_t end, Fn&& fn);
+
+            std::unordered_map<void*, Allocation> allocations_;
+    };
+
+    /**
+     * @brief Find the dependency edges of a list of tasks.
+     * 
+     * The edges are stored in CSR form: the predecessors of task i are 
+     * preds[pred_offsets[i] .. pred_offsets[i + 1]), sorted and without duplicates.
+     * @param tasks The tasks in recording order.
+     * @param tracker A tracker to use as scratch. It is cleared first.
+     * @param pred_offsets Receives the start of each predecessor list, plus one end entry.
+     * @param preds Receives the predecessor ids.
+     */
+    void build_task_edges(std::span<const TaskRecord> tasks, 
+                          RangeTracker& tracker, 
+                          std::vector<uint32_t>& pred_offsets, 
+                          std::vector<uint32_t>& preds);
+
+} // namespace SushiBLAS
@@ -0,0 +1,144 @@
+/**************************************************************************/
+/* task_arena.hpp                                                         */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include <new>
+#include <span>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+
+namespace SushiBLAS 
+{
+    /**
+     * @class TaskArena
+     * @brief A bump allocator for short-lived task data.
+     * 
+     * The Engine puts the access lists and the work closures of queued tasks here 
+     * instead of on the heap. Memory is never freed one by one. reset() runs the 
+     * destructors of created objects and rewinds to the start, keeping all blocks 
+     * for the next epoch. After the first few steps no new memory is requested.
+     */
+    class TaskArena 
+    {
+        public:
+            /** @brief Size of one memory block. Bigger requests get their own block. */
+            static constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+            TaskArena() = default;
+            ~TaskArena();
+
+            TaskArena(const TaskArena&) = delete;
+            TaskArena& operator=(const TaskArena&) = delete;
+
+            /**
+             * @brief Get raw memory from the arena.
+             * @param bytes Number of bytes.
+             * @param align Alignment of the returned address (power of two).
+             * @return Pointer to the memory. It stays valid until reset().
+             */
+            void* allocate(size_t bytes, size_t align = alignof(std::max_align_t));
+
+            /**
+             * @brief Construct an object in the arena.
+             * 
+             * If the type has a destructor, it is called by reset() or by the arena destructor.
+             * @return Pointer to the new object.
+             */
+            template<typename T, typename... Args>
+            T* create(Args&&... args)
+            {
+                T* obj = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+
+                if constexpr (!std::is_trivially_destructible_v<T>)
+                {
+                    auto* entry = new (allocate(sizeof(DtorEntry), alignof(DtorEntry))) DtorEntry;
+                    entry->destroy = [](void* p) { static_cast<T*>(p)->~T(); };
+                    entry->object = obj;
+                    entry->next = dtors_;
+                    dtors_ = entry;
+                }
+                return obj;
+            }
+
+            /**
+             * @brief Copy a list of trivially copyable values into the arena.
+             * @param src The values to copy.
+             * @return A span over the copy.
+             */
+            template<typename T>
+            std::span<T> copy(std::span<const T> src)
+            {
+                static_assert(std::is_trivially_copyable_v<T>, "Arena copies must be trivially copyable.");
+                if (src.empty()) return {};
+
+                T* dst = static_cast<T*>(allocate(src.size_bytes(), alignof(T)));
+                std::copy(src.begin(), src.end(), dst);
+                return {dst, src.size()};
+            }
+
+            /** @brief Destroy all created objects and make all memory free again. */
+            void reset();
+
+            /** @brief Get the number of bytes handed out since the last reset(). */
+            inline size_t bytes_used() const { return used_; }
+
+            /** @brief Get the number of bytes owned by the arena. */
+            size_t bytes_reserved() const;
+
+        private:
+            struct Block 
+            {
+                std::unique_ptr<std::byte[]> data;
+                size_t size;
+            };
+
+            struct DtorEntry 
+            {
+                void (*destroy)(void*);
+                void* object;
+                DtorEntry* next;
+            };
+
+            void run_destructors();
+
+            std::vector<Block> blocks_;
+            size_t current_ = 0;
+            size_t offset_ = 0;
+            size_t used_ = 0;
+            DtorEntry* dtors_ = nullptr;
+    };
+
+} // namespace SushiBLAS
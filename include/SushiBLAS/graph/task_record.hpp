@@ -0,0 +1,126 @@
+/**************************************************************************/
+/* task_record.hpp                                                        */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include <span>
+#include <vector>
+#include <cstdint>
+#include <type_traits>
+#include <sycl/sycl.hpp>
+#include <SushiBLAS/graph/fusion.hpp>
+#include <SushiRuntime/graph/node.hpp>
+#include <SushiBLAS/graph/task_arena.hpp>
+#include <SushiBLAS/graph/access_range.hpp>
+#include <SushiRuntime/graph/task_types.hpp>
+
+namespace SushiBLAS 
+{
+    /**
+     * @struct OpCost
+     * @brief The work an operation does, used for performance statistics.
+     */
+    struct OpCost 
+    {
+        /** @brief Floating point operations. */
+        uint64_t flops = 0;
+
+        /** @brief Bytes read plus bytes written. 0 means: use the size of the access ranges. */
+        uint64_t bytes = 0;
+    };
+
+    /**
+     * @struct TaskRecord
+     * @brief A task recorded by the Engine before it reaches the hardware.
+     * 
+     * It keeps everything that an operation passes to Engine::add_task, so the 
+     * task can be replayed or analyzed later without calling the operation again.
+     * The access lists point into the TaskArena that owns the record's epoch or graph.
+     */
+    struct TaskRecord 
+    {
+        /** @brief The semantic metadata of the operation (name, op_id, params). */
+        SushiRuntime::Graph::TaskMetadata meta;
+
+        /** @brief Byte ranges this task reads. */
+        std::span<AccessRange> reads;
+
+        /** @brief Byte ranges this task writes. */
+        std::span<AccessRange> writes;
+
+        /** @brief The host function that submits the work to a SYCL queue. */
+        SushiRuntime::Graph::HostWork work;
+
+        /** @brief Optional description used by the elementwise fusion pass. */
+        FusionInfo fusion;
+
+        /** @brief Estimated work of the task, see OpCost. */
+        OpCost cost;
+    };
+
+    /**
+     * @brief Get the bytes a task moves.
+     * @param rec The task.
+     * @return The bytes of its OpCost, or else the summed size of its access ranges.
+     */
+    inline uint64_t task_bytes(const TaskRecord& rec)
+    {
+        if (rec.cost.bytes) return rec.cost.bytes;
+
+        uint64_t total = 0;
+        for (const AccessRange& r : rec.reads) total += r.bytes();
+        for (const AccessRange& r : rec.writes) total += r.bytes();
+        return total;
+    }
+
+    /**
+     * @brief Move a work closure into an arena and wrap it as HostWork.
+     * 
+     * The returned HostWork only holds a pointer to the closure. A pointer fits in 
+     * the small buffer of std::function, so no heap memory is used per task.
+     * @param arena The arena that owns the closure. It must outlive the HostWork.
+     * @param work The closure to store.
+     * @return A HostWork that calls the stored closure.
+     */
+    template<typename Work>
+    SushiRuntime::Graph::HostWork make_arena_work(TaskArena& arena, Work&& work)
+    {
+        using W = std::decay_t<Work>;
+
+        if constexpr (std::is_same_v<W, SushiRuntime::Graph::HostWork>)
+            return std::forward<Work>(work);
+        else
+        {
+            W* obj = arena.create<W>(std::forward<Work>(work));
+            return [obj](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event { return (*obj)(q, deps); };
+        }
+    }
+
+} // namespace SushiBLAS
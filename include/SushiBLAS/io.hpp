@@ -30,13 +30,33 @@
 
 #pragma once
 
+#include <map>
 #include <string>
+#include <future>
+#include <vector>
+#include <utility>
 #include <SushiBLAS/tensor.hpp>
+#include <SushiBLAS/io/archive.hpp>
+#include <SushiBLAS/io/safetensors.hpp>
+#include <SushiBLAS/io/mapped_storage.hpp>
 
 namespace SushiBLAS
 {
     class Engine;
 
+    /** @brief File formats that IO can read and write. */
+    enum class FileFormat 
+    {
+        /** @brief The native format, with a header that holds shape, dtype and layout. */
+        SUSHI,
+
+        /** @brief The NumPy .npy format. */
+        NPY,
+
+        /** @brief Raw data without a header. */
+        BIN
+    };
+
     /**
      * @class IO
      * @brief Input/Output operations for Tensors.
@@ -60,7 +80,6 @@ namespace SushiBLAS
              * @param t The tensor to save.
              * @param path The filesystem path to save the file to.
              */
-            // TODO: Implement asynchronous support for save operations using TaskGraph (add_host_node).
             void save(const Tensor& t, const std::string& path);
 
             /**
@@ -72,6 +91,98 @@ namespace SushiBLAS
              */
             void load(Tensor& t, const std::string& path);
 
+            /**
+             * @brief Map a .sushi file into memory without reading it.
+             * 
+             * The returned tensor uses HOST memory that is backed by the file, so only the 
+             * pages that are touched are read from disk. Files saved before version 2 can 
+             * also be mapped, but their data is not page aligned.
+             * 
+             * READ_ONLY tensors must not be written. COPY_ON_WRITE tensors can be written, 
+             * and the changes stay in memory. The mapping is closed when the last tensor 
+             * that uses it is destroyed.
+             * 
+             * @param path The filesystem path of the .sushi file.
+             * @param mode How the mapped pages may be used.
+             * @return A tensor with the shape, dtype and layout stored in the file.
+             */
+            Tensor map(const std::string& path, MapMode mode = MapMode::READ_ONLY);
+
+            /**
+             * @brief Save a tensor in the background without stopping queued work.
+             * 
+             * This queues a task that copies the tensor to a pinned host buffer once the 
+             * tasks that write it are done. The file is then written by the engine's IO 
+             * thread. Tasks that write the tensor later only wait for the copy, so compute 
+             * goes on while the file is written.
+             * 
+             * The task runs with the next execute(), like any other operation.
+             * @param t The tensor to save.
+             * @param path The filesystem path to save the file to.
+             * @param format The file format.
+             * @return A future that is ready when the file is written, or holds the error.
+             * @throws std::runtime_error If the engine is capturing a graph.
+             */
+            std::future<void> save_async(const Tensor& t, const std::string& path, FileFormat format = FileFormat::SUSHI);
+
+            /**
+             * @brief Load a tensor in the background.
+             * 
+             * The IO thread starts reading the file into a pinned host buffer at once. 
+             * A queued task copies the buffer into the tensor after the read finished and 
+             * after earlier tasks that use the tensor, so later tasks see the loaded data.
+             * 
+             * The task runs with the next execute(), like any other operation.
+             * @param t The target tensor to load data into.
+             * @param path The filesystem path of the file.
+             * @param format The file format.
+             * @return A future that is ready when the tensor holds the data, or holds the error.
+             * @throws std::runtime_error If the engine is capturing a graph.
+             */
+            std::future<void> load_async(Tensor& t, const std::string& path, FileFormat format = FileFormat::SUSHI);
+
+            /**
+             * @brief Save many named tensors into one archive file.
+             * 
+             * This opens one file instead of one per tensor. Payloads are written by 
+             * several threads at once, and each is stored with a checksum.
+             * @param tensors The tensors and their names. Names must be unique.
+             * @param path The filesystem path of the archive.
+             */
+            void save_archive(const std::vector<std::pair<std::string, Tensor>>& tensors, const std::string& path);
+
+            /**
+             * @brief Open an archive written by save_archive().
+             * 
+             * Only the index is read. Tensors are read one by one when they are asked for.
+             * @param path The filesystem path of the archive.
+             * @return The open archive.
+             */
+            Archive open_archive(const std::string& path);
+
+            /**
+             * @brief Save named tensors as a .safetensors file.
+             * 
+             * Tensors must be ROW_MAJOR (or rank 1) and not COMPLEX64, which safetensors 
+             * cannot store.
+             * @param tensors The tensors and their names. Names must be unique.
+             * @param path The filesystem path of the file.
+             * @param metadata Strings stored in the "__metadata__" entry.
+             */
+            void save_safetensors(const std::vector<std::pair<std::string, Tensor>>& tensors, const std::string& path,
+                                  const std::map<std::string, std::string>& metadata = {});
+
+            /**
+             * @brief Map a .safetensors file and read its header.
+             * 
+             * Tensors taken with SafeTensors::get() use the mapped file directly, 
+             * so loading costs only the pages that are touched.
+             * @param path The filesystem path of the file.
+             * @param mode READ_ONLY, or COPY_ON_WRITE to allow writing the tensors.
+             * @return The open file.
+             */
+            SafeTensors open_safetensors(const std::string& path, MapMode mode = MapMode::READ_ONLY);
+
             /**
              * @brief Save tensor in NumPy .npy format.
              * 
@@ -79,7 +190,6 @@ namespace SushiBLAS
              * @param t The tensor to export.
              * @param path The filesystem path to save the .npy file.
              */
-            // TODO: Implement asynchronous support for save operations using TaskGraph (add_host_node).
             void save_npy(const Tensor& t, const std::string& path);
 
             /**
@@ -96,7 +206,6 @@ namespace SushiBLAS
              * @param t The tensor to save.
              * @param path The filesystem path for the binary file.
              */
-            // TODO: Implement asynchronous support for save operations using TaskGraph (add_host_node).
             void save_bin(const Tensor& t, const std::string& path);
 
             /**
@@ -126,6 +235,12 @@ namespace SushiBLAS
             std::string to_string(const Tensor& t, int precision = 4, int edge_items = 3);
 
         private:
+            /** @brief Wait for queued work and write a tensor in any format. */
+            void save_to(const Tensor& t, const std::string& path, FileFormat format);
+
+            /** @brief Read a file of any format into a tensor. */
+            void load_from(Tensor& t, const std::string& path, FileFormat format);
+
             /**
              * @brief Internal recursive printing engine for N-dimensional tensors.
              */
@@ -0,0 +1,167 @@
+/**************************************************************************/
+/* archive.hpp                                                            */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <unordered_map>
+#include <SushiBLAS/tensor.hpp>
+#include <SushiBLAS/io/file.hpp>
+#include <SushiBLAS/core/common.hpp>
+#include <SushiBLAS/io/mapped_storage.hpp>
+
+namespace SushiBLAS 
+{
+    class Engine;
+
+    /**
+     * @struct ArchiveEntry
+     * @brief The index record of one tensor in an archive.
+     */
+    struct ArchiveEntry 
+    {
+        std::string name;
+        Core::DataType dtype = Core::DataType::FLOAT32;
+        Core::Layout layout = Core::Layout::ROW_MAJOR;
+        int32_t rank = 0;
+        std::array<int64_t, Core::MAX_TENSOR_RANK> shape{};
+
+        /** @brief The position of the payload in the file. It is a multiple of ARCHIVE_ALIGNMENT. */
+        uint64_t offset = 0;
+
+        /** @brief The size of the payload in bytes. */
+        uint64_t bytes = 0;
+
+        /** @brief The checksum of the payload, see archive_checksum(). */
+        uint64_t checksum = 0;
+    };
+
+    /** @brief The alignment of every payload in an archive, so payloads can be mapped or read with O_DIRECT. */
+    inline constexpr uint64_t ARCHIVE_ALIGNMENT = 4096;
+
+    /**
+     * @brief The checksum stored for archive payloads.
+     * 
+     * It is FNV-1a over 8-byte words, so it runs at memory speed.
+     * @param data The payload.
+     * @param bytes The size of the payload.
+     * @return A 64-bit checksum.
+     */
+    uint64_t archive_checksum(const void* data, size_t bytes);
+
+    /**
+     * @class Archive
+     * @brief A file that holds many named tensors, read on demand.
+     * 
+     * The file starts with an index of all tensors, followed by their payloads 
+     * at aligned offsets. Opening an archive reads only the index. Each tensor is 
+     * read when it is asked for, so a partial restore only reads what it uses.
+     * 
+     * Use IO::save_archive() to write one and IO::open_archive() to open one.
+     */
+    class Archive 
+    {
+        public:
+            /**
+             * @brief Open an archive and read its index.
+             * @param e The engine used to create tensors.
+             * @param path The archive file.
+             * @throws std::runtime_error If the file is not a valid archive.
+             */
+            Archive(Engine& e, const std::string& path);
+
+            /** @brief Check if the archive holds a tensor. */
+            bool contains(const std::string& name) const { return lookup_.count(name) != 0; }
+
+            /** @brief The names of all tensors, in the order they were saved. */
+            std::vector<std::string> names() const;
+
+            /** 
+             * @brief Get the index record of a tensor.
+             * @throws std::runtime_error If the name is not in the archive.
+             */
+            const ArchiveEntry& entry(const std::string& name) const;
+
+            /** @brief The index records of all tensors, in the order they were saved. */
+            const std::vector<ArchiveEntry>& entries() const { return entries_; }
+
+            /**
+             * @brief Read one tensor into a new tensor.
+             * @param name The name of the tensor.
+             * @param strat The allocation strategy of the new tensor.
+             * @param verify True to check the payload against its checksum.
+             * @return A tensor with the stored shape, dtype and layout.
+             * @throws std::runtime_error If the name is unknown or the checksum does not match.
+             */
+            Tensor load(const std::string& name, 
+                        SushiRuntime::Memory::AllocStrategy strat = SushiRuntime::Memory::AllocStrategy::SHARED,
+                        bool verify = true);
+
+            /**
+             * @brief Read one tensor into an existing tensor of the same shape and dtype.
+             * @throws std::runtime_error If the tensor does not match the record or the checksum does not match.
+             */
+            void load_into(const std::string& name, Tensor& t, bool verify = true);
+
+            /**
+             * @brief Map one tensor without reading it, see IO::map().
+             * 
+             * The whole archive is mapped once and shared by all mapped tensors.
+             * @param name The name of the tensor.
+             * @return A HOST tensor backed by the file.
+             */
+            Tensor map(const std::string& name);
+
+        private:
+            void read_payload(const ArchiveEntry& e, Tensor& t, bool verify);
+
+            Engine& engine_;
+            File file_;
+            std::vector<ArchiveEntry> entries_;
+            std::unordered_map<std::string, size_t> lookup_;
+            SushiRuntime::sushi_ptr<MappedStorage> mapping_;
+    };
+
+    /**
+     * @brief Write named tensors into one archive file.
+     * 
+     * The index is written first, then the payloads are written by several threads 
+     * at their own offsets. Queued work is waited for before writing.
+     * @param e The engine whose queued work must finish first.
+     * @param tensors The tensors and their names. Names must be unique.
+     * @param path The archive file to create.
+     * @throws std::runtime_error If a name repeats or a write fails.
+     */
+    void write_archive(Engine& e, const std::vector<std::pair<std::string, Tensor>>& tensors, const std::string& path);
+} // namespace SushiBLAS
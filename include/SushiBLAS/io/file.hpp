@@ -0,0 +1,125 @@
+/**************************************************************************/
+/* file.hpp                                                               */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+namespace SushiBLAS 
+{
+    /**
+     * @class File
+     * @brief An open file that is read and written at explicit offsets.
+     * 
+     * It uses pread/pwrite (or overlapped offsets on Windows), so several threads 
+     * can read or write different parts of one file at the same time without a lock.
+     */
+    class File 
+    {
+        public:
+            /** @brief How a file is opened. */
+            enum class Mode 
+            {
+                /** @brief Open an existing file for reading. */
+                READ,
+
+                /** @brief Create or truncate a file for writing. */
+                WRITE,
+
+                /** @brief Open an existing file for writing and keep its content. */
+                UPDATE
+            };
+
+            File() = default;
+
+            /**
+             * @brief Open a file.
+             * 
+             * Direct IO bypasses the page cache. Buffers, sizes and offsets must then be 
+             * aligned to the disk block size. If the file system does not support it, 
+             * the file is opened normally and direct() returns false.
+             * @param path The file to open.
+             * @param mode READ, WRITE or UPDATE.
+             * @param direct True to open with O_DIRECT (unbuffered IO on Windows).
+             * @throws std::runtime_error If the file cannot be opened.
+             */
+            File(const std::string& path, Mode mode, bool direct = false);
+
+            /** @brief Close the file. */
+            ~File();
+
+            File(File&& other) noexcept;
+            File& operator=(File&& other) noexcept;
+            File(const File&) = delete;
+            File& operator=(const File&) = delete;
+
+            /**
+             * @brief Write bytes at an offset. Short writes are retried until all bytes are written.
+             * @throws std::runtime_error If the write fails.
+             */
+            void write_at(const void* data, size_t bytes, uint64_t offset);
+
+            /**
+             * @brief Read bytes at an offset. Short reads are retried until all bytes are read.
+             * @throws std::runtime_error If the read fails or the file ends first.
+             */
+            void read_at(void* data, size_t bytes, uint64_t offset) const;
+
+            /** @brief Get the size of the file in bytes. */
+            uint64_t size() const;
+
+            /** @brief Set the size of the file, so threads can write anywhere inside it. */
+            void resize(uint64_t bytes);
+
+            /** @brief Check if a file is open. */
+            bool is_open() const { return handle_ != INVALID; }
+
+            /** @brief The path the file was opened with. */
+            const std::string& path() const { return path_; }
+
+            /** @brief The mode the file was opened with. */
+            Mode mode() const { return mode_; }
+
+            /** @brief Check if the file bypasses the page cache. */
+            bool direct() const { return direct_; }
+
+        private:
+            void close();
+
+            static constexpr intptr_t INVALID = -1;
+
+            std::string path_;
+            Mode mode_ = Mode::READ;
+            bool direct_ = false;
+            intptr_t handle_ = INVALID;
+    };
+} // namespace SushiBLAS
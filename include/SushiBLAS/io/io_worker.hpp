@@ -0,0 +1,88 @@
+/**************************************************************************/
+/* io_worker.hpp                                                          */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <functional>
+#include <condition_variable>
+
+namespace SushiBLAS 
+{
+    /**
+     * @class IOWorker
+     * @brief A background thread that runs file jobs in order.
+     * 
+     * Async IO operations give their file reads and writes to this thread, so 
+     * neither the caller nor the task graph workers block on the disk. 
+     * The thread is started by the first job.
+     */
+    class IOWorker 
+    {
+        public:
+            IOWorker() = default;
+
+            /** @brief Finish all queued jobs and stop the thread. */
+            ~IOWorker();
+
+            IOWorker(const IOWorker&) = delete;
+            IOWorker& operator=(const IOWorker&) = delete;
+
+            /**
+             * @brief Queue a job. Jobs run one after another in the order they were queued.
+             * 
+             * A job should catch its own errors. Errors that escape it are logged and dropped.
+             * @param job The function to run on the IO thread.
+             */
+            void submit(std::function<void()> job);
+
+            /** @brief Block until all queued jobs are done. */
+            void wait_idle();
+
+            /** 
+             * @brief Get the number of jobs that are queued or running.
+             * @return 0 if the thread is idle.
+             */
+            size_t pending() const;
+
+        private:
+            void run();
+
+            mutable std::mutex mutex_;
+            std::condition_variable work_cv_;
+            std::condition_variable idle_cv_;
+            std::deque<std::function<void()>> jobs_;
+            size_t running_ = 0;
+            bool stop_ = false;
+            std::thread thread_;
+    };
+} // namespace SushiBLAS
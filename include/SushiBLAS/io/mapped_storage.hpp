@@ -0,0 +1,94 @@
+/**************************************************************************/
+/* mapped_storage.hpp                                                     */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include <string>
+#include <cstddef>
+#include <SushiBLAS/storage.hpp>
+
+namespace SushiBLAS 
+{
+    /** @brief How the pages of a mapped file may be used. */
+    enum class MapMode 
+    {
+        /** @brief Pages are shared with the file and cannot be written. */
+        READ_ONLY,
+
+        /** @brief Pages can be written. Written pages become private copies and the file is not changed. */
+        COPY_ON_WRITE
+    };
+
+    /**
+     * @class MappedStorage
+     * @brief A Storage that holds a whole file mapped into host memory.
+     * 
+     * The file is mapped with mmap (or a file mapping on Windows), so nothing is 
+     * read until a page is touched. Tensors use views of this storage, which keep 
+     * the mapping alive. The file is unmapped when the last view is destroyed.
+     * 
+     * The memory is plain host memory, not USM. It has no allocator, and kernels 
+     * can only read it on devices that share the host address space.
+     */
+    class MappedStorage : public Storage 
+    {
+        public:
+            /**
+             * @brief Map a whole file into memory.
+             * 
+             * @param path The file to map.
+             * @param mode READ_ONLY or COPY_ON_WRITE.
+             * @throws std::runtime_error If the file cannot be opened or mapped, or is empty.
+             */
+            explicit MappedStorage(const std::string& path, MapMode mode = MapMode::READ_ONLY);
+
+            /** @brief The path of the mapped file. */
+            const std::string& path() const { return path_; }
+
+            /** @brief The mode the file was mapped with. */
+            MapMode mode() const { return mode_; }
+
+            /** @brief The size of a memory page on this system. */
+            static size_t page_size();
+
+        protected:
+            /** @brief Unmap the file. */
+            ~MappedStorage() override;
+
+        private:
+            std::string path_;
+            MapMode mode_;
+
+            #ifdef _WIN32
+            void* file_handle_ = nullptr;
+            void* mapping_handle_ = nullptr;
+            #endif
+    };
+} // namespace SushiBLAS
@@ -0,0 +1,144 @@
+/**************************************************************************/
+/* parallel_io.hpp                                                        */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <sycl/sycl.hpp>
+#include <condition_variable>
+#include <SushiBLAS/io/file.hpp>
+
+namespace SushiBLAS 
+{
+    /**
+     * @struct IOOptions
+     * @brief Settings of the chunked file transfers used by IO.
+     */
+    struct IOOptions 
+    {
+        /** @brief The size of one chunk. Payloads up to this size are moved by the calling thread alone. */
+        size_t chunk_bytes = size_t(8) << 20;
+
+        /** @brief The number of threads that move chunks, including the caller. */
+        size_t threads = 4;
+
+        /** 
+         * @brief Bypass the page cache with O_DIRECT (or unbuffered IO on Windows).
+         * 
+         * Only parts of a transfer that start at an aligned file offset use it. 
+         * Data always goes through aligned staging buffers then.
+         */
+        bool direct = false;
+    };
+
+    /**
+     * @class ParallelIO
+     * @brief Moves large payloads between memory and a file in chunks on a thread pool.
+     * 
+     * One read or write call on one thread leaves most of the bandwidth of fast 
+     * disks unused. Here a payload is split into chunks, and each chunk is read or 
+     * written at its own offset by a pool thread.
+     * 
+     * For DEVICE memory each thread copies its chunk through a pinned staging buffer, 
+     * so the device copy of one chunk runs while other chunks are on the disk.
+     */
+    class ParallelIO 
+    {
+        public:
+            /** @brief The alignment of offsets, sizes and buffers for direct IO. */
+            static constexpr size_t DIRECT_ALIGNMENT = 4096;
+
+            explicit ParallelIO(const IOOptions& options = {}) : options_(options) {}
+
+            /** @brief Stop the pool threads. */
+            ~ParallelIO();
+
+            ParallelIO(const ParallelIO&) = delete;
+            ParallelIO& operator=(const ParallelIO&) = delete;
+
+            /** 
+             * @brief Change the settings. 
+             * @param options The new settings. Threads are added when first needed.
+             */
+            void set_options(const IOOptions& options);
+
+            /** @brief Get the current settings. */
+            IOOptions options() const;
+
+            /**
+             * @brief Write a payload to a file.
+             * 
+             * @param file The file opened for writing.
+             * @param offset The file offset of the first byte.
+             * @param src The payload.
+             * @param bytes The payload size.
+             * @param device_queue The queue to copy from, if src is DEVICE memory. Null for host memory.
+             * @throws std::runtime_error If a chunk fails.
+             */
+            void write(File& file, uint64_t offset, const void* src, size_t bytes, sycl::queue* device_queue = nullptr);
+
+            /**
+             * @brief Read a payload from a file.
+             * 
+             * @param file The file opened for reading.
+             * @param offset The file offset of the first byte.
+             * @param dst The memory to fill.
+             * @param bytes The payload size.
+             * @param device_queue The queue to copy with, if dst is DEVICE memory. Null for host memory.
+             * @throws std::runtime_error If a chunk fails.
+             */
+            void read(const File& file, uint64_t offset, void* dst, size_t bytes, sycl::queue* device_queue = nullptr);
+
+        private:
+            /** 
+             * @brief Run a worker function on several threads at once and wait for all of them.
+             * 
+             * One copy runs on the calling thread, the others on the pool. The first 
+             * error is thrown again after all copies finished.
+             */
+            void run_workers(size_t workers, const std::function<void()>& worker);
+
+            void ensure_threads(size_t count);
+            void run();
+
+            mutable std::mutex mutex_;
+            std::condition_variable cv_;
+            std::deque<std::function<void()>> jobs_;
+            std::vector<std::thread> threads_;
+            bool stop_ = false;
+            IOOptions options_;
+    };
+} // namespace SushiBLAS
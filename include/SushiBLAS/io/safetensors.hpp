@@ -0,0 +1,148 @@
+/**************************************************************************/
+/* safetensors.hpp                                                        */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include <map>
+#include <array>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <unordered_map>
+#include <SushiBLAS/tensor.hpp>
+#include <SushiBLAS/core/common.hpp>
+#include <SushiBLAS/io/mapped_storage.hpp>
+
+namespace SushiBLAS 
+{
+    class Engine;
+
+    /**
+     * @struct SafeTensorsEntry
+     * @brief One tensor listed in the header of a safetensors file.
+     */
+    struct SafeTensorsEntry 
+    {
+        std::string name;
+        Core::DataType dtype = Core::DataType::FLOAT32;
+        int32_t rank = 0;
+        std::array<int64_t, Core::MAX_TENSOR_RANK> shape{};
+
+        /** @brief The position of the data in the file, counted from the start of the file. */
+        uint64_t offset = 0;
+
+        /** @brief The size of the data in bytes. */
+        uint64_t bytes = 0;
+    };
+
+    /**
+     * @class SafeTensors
+     * @brief A safetensors file mapped into memory.
+     * 
+     * Opening the file maps it and parses its JSON header. get() returns tensors 
+     * that use the mapped data directly, so nothing is copied or read before it 
+     * is used. safetensors data is always row-major.
+     * 
+     * Supported dtypes are F16, F32, F64 and C64. Other dtypes are listed by 
+     * skipped() and cannot be read.
+     */
+    class SafeTensors 
+    {
+        public:
+            /**
+             * @brief Map a safetensors file and parse its header.
+             * @param e The engine used to create tensors for copies.
+             * @param path The .safetensors file.
+             * @param mode READ_ONLY, or COPY_ON_WRITE to allow writing the returned tensors.
+             * @throws std::runtime_error If the file or its header is invalid.
+             */
+            SafeTensors(Engine& e, const std::string& path, MapMode mode = MapMode::READ_ONLY);
+
+            /** @brief Check if the file holds a tensor of a supported dtype. */
+            bool contains(const std::string& name) const { return lookup_.count(name) != 0; }
+
+            /** @brief The names of the tensors with a supported dtype, in file order. */
+            std::vector<std::string> names() const;
+
+            /** 
+             * @brief Get the header record of a tensor.
+             * @throws std::runtime_error If the name is unknown.
+             */
+            const SafeTensorsEntry& entry(const std::string& name) const;
+
+            /** @brief The names of tensors whose dtype SushiBLAS does not support. */
+            const std::vector<std::string>& skipped() const { return skipped_; }
+
+            /** @brief The "__metadata__" strings of the header. */
+            const std::map<std::string, std::string>& metadata() const { return metadata_; }
+
+            /**
+             * @brief Get a tensor that uses the mapped data.
+             * 
+             * If the data is not aligned to its element size, it is copied into a new 
+             * SHARED tensor instead.
+             * @param name The name of the tensor.
+             * @return A HOST tensor backed by the file, or a copy.
+             */
+            Tensor get(const std::string& name);
+
+            /**
+             * @brief Copy a tensor into new memory.
+             * @param name The name of the tensor.
+             * @param strat The allocation strategy of the new tensor.
+             * @return A new tensor with the data of the file.
+             */
+            Tensor load(const std::string& name, 
+                        SushiRuntime::Memory::AllocStrategy strat = SushiRuntime::Memory::AllocStrategy::SHARED);
+
+        private:
+            Engine& engine_;
+            SushiRuntime::sushi_ptr<MappedStorage> mapping_;
+            std::vector<SafeTensorsEntry> entries_;
+            std::unordered_map<std::string, size_t> lookup_;
+            std::vector<std::string> skipped_;
+            std::map<std::string, std::string> metadata_;
+    };
+
+    /**
+     * @brief Write named tensors as a safetensors file.
+     * 
+     * Tensors are stored by falling element size, so every tensor is aligned to 
+     * its element size when the file is mapped. Queued work is waited for first.
+     * @param e The engine whose queued work must finish first.
+     * @param tensors The tensors and their names. Names must be unique.
+     * @param path The file to create.
+     * @param metadata Strings stored as "__metadata__".
+     * @throws std::runtime_error If a name repeats, a tensor is COLUMN_MAJOR or has the COMPLEX64 dtype.
+     */
+    void write_safetensors(Engine& e, const std::vector<std::pair<std::string, Tensor>>& tensors, const std::string& path, 
+                           const std::map<std::string, std::string>& metadata = {});
+} // namespace SushiBLAS
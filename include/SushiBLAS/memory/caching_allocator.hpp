@@ -0,0 +1,224 @@
+/**************************************************************************/
+/* caching_allocator.hpp                                                  */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+#include <sycl/sycl.hpp>
+#include <SushiRuntime/core/sushi_ptr.hpp>
+#include <SushiRuntime/memory/memory_pool.hpp>
+#include <SushiRuntime/memory/usm_allocator.hpp>
+
+namespace SushiBLAS 
+{
+    /**
+     * @struct MemoryStats
+     * @brief Counters of a CachingAllocator, in bytes unless noted.
+     */
+    struct MemoryStats 
+    {
+        /** @brief Memory held by live tensors, rounded up to size classes. */
+        size_t in_use_bytes = 0;
+
+        /** @brief The highest in_use_bytes since creation or reset_peak(). */
+        size_t peak_bytes = 0;
+
+        /** @brief Freed memory kept for reuse. */
+        size_t cached_bytes = 0;
+
+        /** @brief All memory taken from the upstream allocator. */
+        size_t reserved_bytes = 0;
+
+        /** @brief Allocations served from the cache and from the upstream allocator. */
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+    };
+
+    /**
+     * @class CachingAllocator
+     * @brief A USM allocator that keeps freed blocks for reuse.
+     * 
+     * USM allocation and free are slow, since they map and unmap pages. This 
+     * allocator rounds sizes up to size classes and keeps freed blocks in free 
+     * lists, so the next tensor of the same class reuses them.
+     * 
+     * - Sizes up to SMALL_LIMIT come from slabs of 64 slots managed by a 
+     *   SushiRuntime BitmaskMemoryPool, so they are taken without a lock.
+     * - Larger sizes use free lists split into shards. Each thread uses its 
+     *   own shard first, so threads rarely share a lock.
+     * - A freed block is reused only after the fence events set by the Engine 
+     *   complete, so a kernel that still uses it can not race a new owner.
+     */
+    class CachingAllocator : public SushiRuntime::Memory::USMAllocator 
+    {
+        public:
+            /** @brief Largest size served from bitmask slabs. */
+            static constexpr size_t SMALL_LIMIT = 4096;
+
+            /** @brief Number of free list shards. */
+            static constexpr size_t SHARDS = 16;
+
+            /**
+             * @brief Create a caching layer over another allocator.
+             * @param upstream The allocator that provides the memory.
+             */
+            explicit CachingAllocator(SushiRuntime::sushi_ptr<SushiRuntime::Memory::USMAllocator> upstream);
+
+            /** @brief Waits for the fences of cached blocks, then returns all memory upstream. */
+            ~CachingAllocator() override;
+
+            void* allocate(size_t bytes, 
+                           SushiRuntime::Memory::AllocStrategy strategy = SushiRuntime::Memory::AllocStrategy::SHARED,
+                           size_t alignment = SushiRuntime::Core::DEFAULT_ALIGNMENT) override;
+
+            void deallocate(void* ptr) override;
+
+            sycl::device get_device_of(void* ptr) override;
+
+            /**
+             * @brief Set the events that blocks freed from now on must wait for.
+             * 
+             * The Engine sets the done events of its running epochs after each flush.
+             * @param events The events. An empty list makes freed blocks reusable at once.
+             */
+            void set_fence(std::vector<sycl::event> events);
+
+            /**
+             * @brief Return cached large blocks whose fences completed to the upstream allocator.
+             * 
+             * Slabs of small blocks are kept until the allocator is destroyed.
+             * @return The number of bytes returned.
+             */
+            size_t trim();
+
+            /** @brief Get the current counters. */
+            MemoryStats stats() const;
+
+            /** @brief Start a new high-water mark at the current in-use size. */
+            void reset_peak();
+
+            /**
+             * @brief Round a size up to its size class.
+             * 
+             * Small sizes use powers of two. Larger sizes use four classes per power 
+             * of two, so at most a quarter is wasted. From 256 MB on, sizes are 
+             * rounded to 2 MB.
+             * @param bytes The requested size.
+             * @return The size of the block that is allocated.
+             */
+            static size_t size_class(size_t bytes);
+
+        private:
+            using Fence = std::shared_ptr<const std::vector<sycl::event>>;
+
+            /** @brief A live block, found by its pointer on free. */
+            struct Block 
+            {
+                size_t bytes = 0;
+                SushiRuntime::Memory::AllocStrategy strategy;
+                SushiRuntime::Memory::MemoryPage* page = nullptr;
+                bool cached = true;
+            };
+
+            /** @brief A freed block waiting for reuse. */
+            struct FreeBlock 
+            {
+                void* ptr = nullptr;
+                size_t bytes = 0;
+                Fence fence;
+                SushiRuntime::Memory::MemoryPage* page = nullptr;
+            };
+
+            struct Shard 
+            {
+                std::mutex mutex;
+                std::unordered_map<uint64_t, std::vector<FreeBlock>> free;
+            };
+
+            struct LiveShard 
+            {
+                std::mutex mutex;
+                std::unordered_map<void*, Block> blocks;
+            };
+
+            /** @brief The slabs of one small size class and strategy. Pages are only added, never removed. */
+            struct SlabList 
+            {
+                std::mutex mutex;
+                std::atomic<SushiRuntime::Memory::MemoryPage*> root{nullptr};
+                SushiRuntime::Memory::MemoryPage* tail = nullptr;
+                std::vector<std::unique_ptr<SushiRuntime::Memory::MemoryPage>> pages;
+                std::vector<FreeBlock> pending;
+            };
+
+            static constexpr size_t STRATEGIES = 3;
+            static constexpr size_t SMALL_CLASSES = 6;
+
+            /** @brief Take a slot from the slabs of a small class, adding a slab if all are full. */
+            void* allocate_small(size_t bytes, SushiRuntime::Memory::AllocStrategy strategy, SushiRuntime::Memory::MemoryPage*& page);
+
+            /** @brief Take a free block of a large class from any shard, or else from upstream. */
+            void* allocate_large(size_t bytes, SushiRuntime::Memory::AllocStrategy strategy);
+
+            /** @brief Take a block whose fence completed from one free list. */
+            void* take_free(Shard& shard, uint64_t key);
+
+            /** @brief Give freed small slots whose fences completed back to their pages. */
+            void release_pending(SlabList& list);
+
+            SlabList& slab_list(size_t bytes, SushiRuntime::Memory::AllocStrategy strategy);
+            LiveShard& live_shard(void* ptr);
+            Shard& own_shard();
+            Fence current_fence();
+
+            SushiRuntime::sushi_ptr<SushiRuntime::Memory::USMAllocator> upstream_;
+            SushiRuntime::Memory::BitmaskMemoryPool pool_;
+
+            std::array<Shard, SHARDS> shards_;
+            std::array<LiveShard, SHARDS> live_;
+            std::array<SlabList, STRATEGIES * SMALL_CLASSES> slabs_;
+
+            std::mutex fence_mutex_;
+            Fence fence_;
+
+            std::atomic<size_t> in_use_{0};
+            std::atomic<size_t> peak_{0};
+            std::atomic<size_t> reserved_{0};
+            std::atomic<uint64_t> hits_{0};
+            std::atomic<uint64_t> misses_{0};
+    };
+
+} // namespace SushiBLAS
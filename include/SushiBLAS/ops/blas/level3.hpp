@@ -37,6 +37,28 @@ namespace SushiBLAS
 {
     class Engine;
 
+    /**
+     * @struct GemmEpilogue
+     * @brief Work applied to each element of C right after a GEMM.
+     * 
+     * The steps run in this order: C = act(C * scale[j] + bias[j]), where j is the 
+     * column of the element. Every step is optional.
+     */
+    struct GemmEpilogue 
+    {
+        /** @brief Per-column bias vector of N elements, or nullptr. */
+        const Tensor* bias = nullptr;
+
+        /** @brief Per-column scale vector of N elements, or nullptr. */
+        const Tensor* scale = nullptr;
+
+        /** @brief Activation applied last. */
+        Core::Activation activation = Core::Activation::NONE;
+
+        /** @brief Negative slope used by LEAKY_RELU. */
+        float activation_alpha = 0.01f;
+    };
+
     /**
      * @class Level3
      * @brief Matrix-Matrix operations (BLAS Level 3).
@@ -73,6 +95,29 @@ namespace SushiBLAS
                             bool transA = false, bool transB = false,
                             float alpha = 1.0f, float beta = 0.0f);
 
+            /**
+             * @brief GEMM followed by a fused epilogue (scale, bias, activation).
+             * 
+             * Computes C = act((alpha * op(A) * op(B) + beta * C) * scale + bias) as one task. 
+             * The epilogue is done in a single pass over C, instead of one pass for 
+             * each separate elementwise or nonlinear call.
+             * Supports HALF, FLOAT32 and FLOAT64.
+             * 
+             * @param A Input matrix A.
+             * @param B Input matrix B.
+             * @param C Output matrix C.
+             * @param epilogue The bias, scale and activation to apply.
+             * @param transA Whether to transpose A.
+             * @param transB Whether to transpose B.
+             * @param alpha Scalar multiplier for A*B.
+             * @param beta Scalar multiplier for C.
+             * @return sycl::event representing the completion of the operation.
+             */
+            sycl::event gemm(const Tensor& A, const Tensor& B, Tensor& C, 
+                            const GemmEpilogue& epilogue,
+                            bool transA = false, bool transB = false,
+                            float alpha = 1.0f, float beta = 0.0f);
+
             /**
              * @brief Triangular Solve with Multiple Right-Hand Sides (TRSM).
              * 
@@ -43,6 +43,14 @@ namespace SushiBLAS
      * 
      * Provides high-performance independent operations where each element 
      * in the result depends only on its corresponding element in the input(s).
+     * 
+     * Binary operations broadcast their inputs like NumPy: shapes are aligned at 
+     * the last dimension, and dimensions of size 1 or missing leading dimensions 
+     * are repeated to the shape of the output. Nothing is copied to do this.
+     * 
+     * Unary operations work in place or write to a separate output. Ternary 
+     * operations such as fma() and addcmul() run as one kernel, so no temporary 
+     * tensors are needed.
      */
     class ElementwiseOps 
     {
@@ -101,6 +109,15 @@ namespace SushiBLAS
              */
             sycl::event sqrt(Tensor& t);
 
+            /** 
+             * @brief Element-wise square root, out of place.
+             * Computes out = sqrt(in) for each element. in is not changed.
+             * @param in Input tensor.
+             * @param out Output tensor.
+             * @return sycl::event.
+             */
+            sycl::event sqrt(const Tensor& in, Tensor& out);
+
             /** 
              * @brief Element-wise square.
              * Computes t = t * t for each element in-place.
@@ -109,6 +126,15 @@ namespace SushiBLAS
              */
             sycl::event square(Tensor& t);
 
+            /** 
+             * @brief Element-wise square, out of place.
+             * Computes out = in * in for each element. in is not changed.
+             * @param in Input tensor.
+             * @param out Output tensor.
+             * @return sycl::event.
+             */
+            sycl::event square(const Tensor& in, Tensor& out);
+
             /** 
              * @brief Element-wise reciprocal.
              * Computes t = 1 / t for each element in-place.
@@ -117,6 +143,15 @@ namespace SushiBLAS
              */
             sycl::event reciprocal(Tensor& t);
 
+            /** 
+             * @brief Element-wise reciprocal, out of place.
+             * Computes out = 1 / in for each element. in is not changed.
+             * @param in Input tensor.
+             * @param out Output tensor.
+             * @return sycl::event.
+             */
+            sycl::event reciprocal(const Tensor& in, Tensor& out);
+
             /** 
              * @brief Element-wise negation.
              * Computes t = -t for each element in-place.
@@ -125,6 +160,15 @@ namespace SushiBLAS
              */
             sycl::event neg(Tensor& t);
 
+            /** 
+             * @brief Element-wise negation, out of place.
+             * Computes out = -in for each element. in is not changed.
+             * @param in Input tensor.
+             * @param out Output tensor.
+             * @return sycl::event.
+             */
+            sycl::event neg(const Tensor& in, Tensor& out);
+
             /** 
              * @brief Element-wise exponential.
              * Computes t = exp(t) for each element in-place.
@@ -133,6 +177,15 @@ namespace SushiBLAS
              */
             sycl::event exp(Tensor& t);
 
+            /** 
+             * @brief Element-wise exponential, out of place.
+             * Computes out = exp(in) for each element. in is not changed.
+             * @param in Input tensor.
+             * @param out Output tensor.
+             * @return sycl::event.
+             */
+            sycl::event exp(const Tensor& in, Tensor& out);
+
             /** 
              * @brief Element-wise natural logarithm.
              * Computes t = log(t) for each element in-place.
@@ -141,6 +194,15 @@ namespace SushiBLAS
              */
             sycl::event log(Tensor& t);
 
+            /** 
+             * @brief Element-wise natural logarithm, out of place.
+             * Computes out = log(in) for each element. in is not changed.
+             * @param in Input tensor.
+             * @param out Output tensor.
+             * @return sycl::event.
+             */
+            sycl::event log(const Tensor& in, Tensor& out);
+
             /** 
              * @brief Element-wise absolute value.
              * Computes t = abs(t) for each element in-place.
@@ -149,6 +211,15 @@ namespace SushiBLAS
              */
             sycl::event abs(Tensor& t);
 
+            /** 
+             * @brief Element-wise absolute value, out of place.
+             * Computes out = abs(in) for each element. in is not changed.
+             * @param in Input tensor.
+             * @param out Output tensor.
+             * @return sycl::event.
+             */
+            sycl::event abs(const Tensor& in, Tensor& out);
+
             /** 
              * @brief Element-wise power function.
              * Computes t = t^exponent for each element in-place.
@@ -158,6 +229,16 @@ namespace SushiBLAS
              */
             sycl::event pow(Tensor& t, float exponent);
 
+            /** 
+             * @brief Element-wise power function, out of place.
+             * Computes out = in^exponent for each element. in is not changed.
+             * @param in Input tensor.
+             * @param out Output tensor.
+             * @param exponent The power to raise elements to.
+             * @return sycl::event.
+             */
+            sycl::event pow(const Tensor& in, Tensor& out, float exponent);
+
             /** 
              * @brief Element-wise sine.
              * Computes t = sin(t) for each element in-place.
@@ -166,6 +247,15 @@ namespace SushiBLAS
              */
             sycl::event sin(Tensor& t);
 
+            /** 
+             * @brief Element-wise sine, out of place.
+             * Computes out = sin(in) for each element. in is not changed.
+             * @param in Input tensor.
+             * @param out Output tensor.
+             * @return sycl::event.
+             */
+            sycl::event sin(const Tensor& in, Tensor& out);
+
             /** 
              * @brief Element-wise cosine.
              * Computes t = cos(t) for each element in-place.
@@ -174,6 +264,15 @@ namespace SushiBLAS
              */
             sycl::event cos(Tensor& t);
 
+            /** 
+             * @brief Element-wise cosine, out of place.
+             * Computes out = cos(in) for each element. in is not changed.
+             * @param in Input tensor.
+             * @param out Output tensor.
+             * @return sycl::event.
+             */
+            sycl::event cos(const Tensor& in, Tensor& out);
+
             /** 
              * @brief Element-wise tangent.
              * Computes t = tan(t) for each element in-place.
@@ -182,6 +281,15 @@ namespace SushiBLAS
              */
             sycl::event tan(Tensor& t);
 
+            /** 
+             * @brief Element-wise tangent, out of place.
+             * Computes out = tan(in) for each element. in is not changed.
+             * @param in Input tensor.
+             * @param out Output tensor.
+             * @return sycl::event.
+             */
+            sycl::event tan(const Tensor& in, Tensor& out);
+
             /** 
              * @brief Element-wise arcsine.
              * Computes t = asin(t) for each element in-place.
@@ -190,6 +298,15 @@ namespace SushiBLAS
              */
             sycl::event asin(Tensor& t);
 
+            /** 
+             * @brief Element-wise arcsine, out of place.
+             * Computes out = asin(in) for each element. in is not changed.
+             * @param in Input tensor.
+             * @param out Output tensor.
+             * @return sycl::event.
+             */
+            sycl::event asin(const Tensor& in, Tensor& out);
+
             /** 
              * @brief Element-wise arccosine.
              * Computes t = acos(t) for each element in-place.
@@ -198,6 +315,15 @@ namespace SushiBLAS
              */
             sycl::event acos(Tensor& t);
 
+            /** 
+             * @brief Element-wise arccosine, out of place.
+             * Computes out = acos(in) for each element. in is not changed.
+             * @param in Input tensor.
+             * @param out Output tensor.
+             * @return sycl::event.
+             */
+            sycl::event acos(const Tensor& in, Tensor& out);
+
             /** 
              * @brief Element-wise arctangent.
              * Computes t = atan(t) for each element in-place.
@@ -206,6 +332,15 @@ namespace SushiBLAS
              */
             sycl::event atan(Tensor& t);
 
+            /** 
+             * @brief Element-wise arctangent, out of place.
+             * Computes out = atan(in) for each element. in is not changed.
+             * @param in Input tensor.
+             * @param out Output tensor.
+             * @return sycl::event.
+             */
+            sycl::event atan(const Tensor& in, Tensor& out);
+
             /** 
              * @brief Element-wise hyperbolic sine.
              * Computes t = sinh(t) for each element in-place.
@@ -214,6 +349,15 @@ namespace SushiBLAS
              */
             sycl::event sinh(Tensor& t);
 
+            /** 
+             * @brief Element-wise hyperbolic sine, out of place.
+             * Computes out = sinh(in) for each element. in is not changed.
+             * @param in Input tensor.
+             * @param out Output tensor.
+             * @return sycl::event.
+             */
+            sycl::event sinh(const Tensor& in, Tensor& out);
+
             /** 
              * @brief Element-wise hyperbolic cosine.
              * Computes t = cosh(t) for each element in-place.
@@ -222,6 +366,15 @@ namespace SushiBLAS
              */
             sycl::event cosh(Tensor& t);
 
+            /** 
+             * @brief Element-wise hyperbolic cosine, out of place.
+             * Computes out = cosh(in) for each element. in is not changed.
+             * @param in Input tensor.
+             * @param out Output tensor.
+             * @return sycl::event.
+             */
+            sycl::event cosh(const Tensor& in, Tensor& out);
+
             /** 
              * @brief Element-wise inverse hyperbolic sine.
              * Computes t = asinh(t) for each element in-place.
@@ -230,6 +383,15 @@ namespace SushiBLAS
              */
             sycl::event asinh(Tensor& t);
 
+            /** 
+             * @brief Element-wise inverse hyperbolic sine, out of place.
+             * Computes out = asinh(in) for each element. in is not changed.
+             * @param in Input tensor.
+             * @param out Output tensor.
+             * @return sycl::event.
+             */
+            sycl::event asinh(const Tensor& in, Tensor& out);
+
             /** 
              * @brief Element-wise inverse hyperbolic cosine.
              * Computes t = acosh(t) for each element in-place.
@@ -238,6 +400,15 @@ namespace SushiBLAS
              */
             sycl::event acosh(Tensor& t);
 
+            /** 
+             * @brief Element-wise inverse hyperbolic cosine, out of place.
+             * Computes out = acosh(in) for each element. in is not changed.
+             * @param in Input tensor.
+             * @param out Output tensor.
+             * @return sycl::event.
+             */
+            sycl::event acosh(const Tensor& in, Tensor& out);
+
             /** 
              * @brief Element-wise inverse hyperbolic tangent.
              * Computes t = atanh(t) for each element in-place.
@@ -246,6 +417,15 @@ namespace SushiBLAS
              */
             sycl::event atanh(Tensor& t);
 
+            /** 
+             * @brief Element-wise inverse hyperbolic tangent, out of place.
+             * Computes out = atanh(in) for each element. in is not changed.
+             * @param in Input tensor.
+             * @param out Output tensor.
+             * @return sycl::event.
+             */
+            sycl::event atanh(const Tensor& in, Tensor& out);
+
             /** 
              * @brief Element-wise ceiling.
              * Computes t = ceil(t) for each element in-place.
@@ -254,6 +434,15 @@ namespace SushiBLAS
              */
             sycl::event ceil(Tensor& t);
 
+            /** 
+             * @brief Element-wise ceiling, out of place.
+             * Computes out = ceil(in) for each element. in is not changed.
+             * @param in Input tensor.
+             * @param out Output tensor.
+             * @return sycl::event.
+             */
+            sycl::event ceil(const Tensor& in, Tensor& out);
+
             /** 
              * @brief Element-wise floor.
              * Computes t = floor(t) for each element in-place.
@@ -262,6 +451,15 @@ namespace SushiBLAS
              */
             sycl::event floor(Tensor& t);
 
+            /** 
+             * @brief Element-wise floor, out of place.
+             * Computes out = floor(in) for each element. in is not changed.
+             * @param in Input tensor.
+             * @param out Output tensor.
+             * @return sycl::event.
+             */
+            sycl::event floor(const Tensor& in, Tensor& out);
+
             /** 
              * @brief Element-wise rounding.
              * Computes t = round(t) for each element in-place.
@@ -270,6 +468,15 @@ namespace SushiBLAS
              */
             sycl::event round(Tensor& t);
 
+            /** 
+             * @brief Element-wise rounding, out of place.
+             * Computes out = round(in) for each element. in is not changed.
+             * @param in Input tensor.
+             * @param out Output tensor.
+             * @return sycl::event.
+             */
+            sycl::event round(const Tensor& in, Tensor& out);
+
             /** 
              * @brief Element-wise minimum.
              * Computes C = min(A, B) element-wise.
@@ -320,6 +527,74 @@ namespace SushiBLAS
              */
             sycl::event clamp(Tensor& t, float min_val, float max_val);
 
+            /** 
+             * @brief Element-wise clamping, out of place.
+             * Computes out = max(min_val, min(max_val, in)) for each element. in is not changed.
+             * @param in Input tensor.
+             * @param out Output tensor.
+             * @param min_val Minimum value.
+             * @param max_val Maximum value.
+             * @return sycl::event.
+             */
+            sycl::event clamp(const Tensor& in, Tensor& out, float min_val, float max_val);
+
+            /** 
+             * @brief Fused multiply-add.
+             * Computes out = A * B + C element-wise in one pass.
+             * @param A First factor.
+             * @param B Second factor.
+             * @param C Addend.
+             * @param out Output tensor.
+             * @return sycl::event.
+             */
+            sycl::event fma(const Tensor& A, const Tensor& B, const Tensor& C, Tensor& out);
+
+            /** 
+             * @brief Linear interpolation with a weight per element.
+             * Computes out = start + weight * (end - start) element-wise in one pass.
+             * @param start Values at weight 0.
+             * @param end Values at weight 1.
+             * @param weight Interpolation weights.
+             * @param out Output tensor.
+             * @return sycl::event.
+             */
+            sycl::event lerp(const Tensor& start, const Tensor& end, const Tensor& weight, Tensor& out);
+
+            /** 
+             * @brief Linear interpolation with one weight.
+             * Computes out = start + weight * (end - start) element-wise in one pass.
+             * @param start Values at weight 0.
+             * @param end Values at weight 1.
+             * @param weight Interpolation weight.
+             * @param out Output tensor.
+             * @return sycl::event.
+             */
+            sycl::event lerp(const Tensor& start, const Tensor& end, float weight, Tensor& out);
+
+            /** 
+             * @brief Add a scaled product.
+             * Computes out = input + value * t1 * t2 element-wise in one pass.
+             * @param input Tensor to add to.
+             * @param t1 First factor.
+             * @param t2 Second factor.
+             * @param value Scale of the product.
+             * @param out Output tensor. It can be the same tensor as input.
+             * @return sycl::event.
+             */
+            sycl::event addcmul(const Tensor& input, const Tensor& t1, const Tensor& t2, float value, Tensor& out);
+
+            /** 
+             * @brief Add a scaled quotient.
+             * Computes out = input + value * t1 / t2 element-wise in one pass.
+             * @param input Tensor to add to.
+             * @param t1 Dividend.
+             * @param t2 Divisor.
+             * @param value Scale of the quotient.
+             * @param out Output tensor. It can be the same tensor as input.
+             * @return sycl::event.
+             */
+            sycl::event addcdiv(const Tensor& input, const Tensor& t1, const Tensor& t2, float value, Tensor& out);
+
         private:
             Engine& engine_;
     };
@@ -0,0 +1,432 @@
+/**************************************************************************/
+/* expression.hpp                                                         */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <concepts>
+#include <type_traits>
+#include <sycl/sycl.hpp>
+#include <SushiBLAS/engine.hpp>
+#include <SushiBLAS/tensor.hpp>
+#include <SushiBLAS/core/logger.hpp>
+#include <SushiRuntime/graph/task_types.hpp>
+
+namespace SushiBLAS 
+{
+    /**
+     * @brief Position of one output element, passed to every node of a bound expression.
+     * 
+     * coord is only filled when a leaf or the output is not a dense row-major array.
+     */
+    struct ExprIndex 
+    {
+        int64_t linear = 0;
+        int64_t coord[Core::MAX_TENSOR_RANK] = {};
+    };
+
+    namespace Expr 
+    {
+        /** @brief Scalar operations used by UnaryExpr and BinaryExpr. They must run in a SYCL kernel. */
+        struct Neg     { template<typename T> T operator()(T x) const { return -x; } };
+        struct Exp     { template<typename T> T operator()(T x) const { return sycl::exp(x); } };
+        struct Log     { template<typename T> T operator()(T x) const { return sycl::log(x); } };
+        struct Sqrt    { template<typename T> T operator()(T x) const { return sycl::sqrt(x); } };
+        struct Abs     { template<typename T> T operator()(T x) const { return sycl::fabs(x); } };
+        struct Square  { template<typename T> T operator()(T x) const { return x * x; } };
+        struct Sin     { template<typename T> T operator()(T x) const { return sycl::sin(x); } };
+        struct Cos     { template<typename T> T operator()(T x) const { return sycl::cos(x); } };
+        struct Tanh    { template<typename T> T operator()(T x) const { return sycl::tanh(x); } };
+        struct Sigmoid { template<typename T> T operator()(T x) const { return T(1) / (T(1) + sycl::exp(-x)); } };
+        struct Relu    { template<typename T> T operator()(T x) const { return x > T(0) ? x : T(0); } };
+
+        /** @brief Operations with constants. The tree keeps them as double, bind() converts them to the element type. */
+        template<typename V = double>
+        struct Pow
+        {
+            V p;
+            template<typename T> T operator()(T x) const { return sycl::pow(x, T(p)); }
+            template<typename T> Pow<T> bind() const { return {T(p)}; }
+        };
+
+        template<typename V = double>
+        struct Clamp
+        {
+            V lo, hi;
+            template<typename T> T operator()(T x) const { return sycl::clamp(x, T(lo), T(hi)); }
+            template<typename T> Clamp<T> bind() const { return {T(lo), T(hi)}; }
+        };
+
+        struct Add { template<typename T> T operator()(T a, T b) const { return a + b; } };
+        struct Sub { template<typename T> T operator()(T a, T b) const { return a - b; } };
+        struct Mul { template<typename T> T operator()(T a, T b) const { return a * b; } };
+        struct Div { template<typename T> T operator()(T a, T b) const { return a / b; } };
+
+        /** @brief Get the operation a kernel of element type T runs. Operations without constants are used as they are. */
+        template<typename T, typename Op>
+        auto bind_op(const Op& op)
+        {
+            if constexpr (requires { op.template bind<T>(); }) return op.template bind<T>();
+            else return op;
+        }
+
+        template<typename Op, typename E> struct UnaryExpr;
+        template<typename Op, typename L, typename R> struct BinaryExpr;
+    } // namespace Expr
+
+    /**
+     * @brief Base of every lazy elementwise expression.
+     * 
+     * Expressions only record the formula. Nothing runs until Engine::assign() turns 
+     * the whole tree into one kernel, which reads each leaf tensor once and writes 
+     * the output once. The output may also be a leaf (e.g. `A = A * 2`), but only as 
+     * the same view: a transposed or broadcast view of the output is rejected. 
+     * The member functions add a unary step to the tree:
+     * @code
+     * auto e = (A * B + C).exp().clamp(0.0f, 1.0f);
+     * engine.assign(out, e);
+     * @endcode
+     * @tparam Derived The concrete expression type (CRTP).
+     */
+    template<typename Derived>
+    struct Expression 
+    {
+        const Derived& derived() const { return static_cast<const Derived&>(*this); }
+
+        auto exp() const { return Expr::UnaryExpr<Expr::Exp, Derived>{{}, derived(), {}}; }
+        auto log() const { return Expr::UnaryExpr<Expr::Log, Derived>{{}, derived(), {}}; }
+        auto sqrt() const { return Expr::UnaryExpr<Expr::Sqrt, Derived>{{}, derived(), {}}; }
+        auto abs() const { return Expr::UnaryExpr<Expr::Abs, Derived>{{}, derived(), {}}; }
+        auto square() const { return Expr::UnaryExpr<Expr::Square, Derived>{{}, derived(), {}}; }
+        auto sin() const { return Expr::UnaryExpr<Expr::Sin, Derived>{{}, derived(), {}}; }
+        auto cos() const { return Expr::UnaryExpr<Expr::Cos, Derived>{{}, derived(), {}}; }
+        auto tanh() const { return Expr::UnaryExpr<Expr::Tanh, Derived>{{}, derived(), {}}; }
+        auto sigmoid() const { return Expr::UnaryExpr<Expr::Sigmoid, Derived>{{}, derived(), {}}; }
+        auto relu() const { return Expr::UnaryExpr<Expr::Relu, Derived>{{}, derived(), {}}; }
+        auto pow(double exponent) const { return Expr::UnaryExpr<Expr::Pow<>, Derived>{{}, derived(), {exponent}}; }
+        auto clamp(double min_val, double max_val) const { return Expr::UnaryExpr<Expr::Clamp<>, Derived>{{}, derived(), {min_val, max_val}}; }
+        auto operator-() const { return Expr::UnaryExpr<Expr::Neg, Derived>{{}, derived(), {}}; }
+    };
+
+    namespace Expr 
+    {
+        /**
+         * @brief Strides of a leaf over the output shape, with NumPy broadcasting.
+         * @return True if the leaf is a dense row-major array of the output shape, so it can be indexed with the linear index.
+         * @throws std::runtime_error If the leaf cannot be broadcast to the output.
+         */
+        inline bool leaf_strides(const Tensor& leaf, const Tensor& out, int64_t* strides)
+        {
+            SB_THROW_IF(leaf.rank > out.rank, "Expression leaf rank {} is larger than the output rank {}.", leaf.rank, out.rank);
+
+            bool flat = true;
+            int64_t dense = 1;
+            for (int d = out.rank - 1; d >= 0; --d)
+            {
+                int dl = d - (out.rank - leaf.rank);
+                int64_t size = dl >= 0 ? leaf.shape[dl] : 1;
+                SB_THROW_IF(size != out.shape[d] && size != 1,
+                            "Expression leaf cannot be broadcast: dimension {} has size {}, output has {}.", d, size, out.shape[d]);
+
+                strides[d] = size == 1 ? 0 : leaf.strides[dl];
+                if (out.shape[d] != 1 && strides[d] != dense) flat = false;
+                dense *= out.shape[d];
+            }
+            return flat;
+        }
+
+        /**
+         * @brief Check if a leaf reads, at every output index, the element the output writes there.
+         * 
+         * Each work item reads its leaves and then writes one output element, so only such a 
+         * leaf may share memory with the output. A transposed or broadcast view of the output 
+         * would read elements that other work items already overwrote.
+         */
+        inline bool reads_in_place(const Tensor& leaf, const Tensor& out)
+        {
+            if (leaf.data() != out.data()) return false;
+
+            int64_t leaf_str[Core::MAX_TENSOR_RANK] = {};
+            int64_t out_str[Core::MAX_TENSOR_RANK] = {};
+            leaf_strides(leaf, out, leaf_str);
+            leaf_strides(out, out, out_str);
+
+            for (int d = 0; d < out.rank; ++d)
+                if (out.shape[d] != 1 && leaf_str[d] != out_str[d]) return false;
+            return true;
+        }
+
+        /** @brief A leaf bound to its device pointer. */
+        template<typename T>
+        struct BoundTensor 
+        {
+            const T* ptr;
+            bool flat;
+            int32_t rank;
+            int64_t strides[Core::MAX_TENSOR_RANK];
+
+            T eval(const ExprIndex& idx) const 
+            {
+                if (flat) return ptr[idx.linear];
+                int64_t offset = 0;
+                for (int d = 0; d < rank; ++d) offset += idx.coord[d] * strides[d];
+                return ptr[offset];
+            }
+        };
+
+        template<typename T>
+        struct BoundScalar 
+        {
+            T value;
+            T eval(const ExprIndex&) const { return value; }
+        };
+
+        template<typename Op, typename E>
+        struct BoundUnary 
+        {
+            Op op;
+            E e;
+            auto eval(const ExprIndex& idx) const { return op(e.eval(idx)); }
+        };
+
+        template<typename Op, typename L, typename R>
+        struct BoundBinary 
+        {
+            Op op;
+            L l;
+            R r;
+            auto eval(const ExprIndex& idx) const { return op(l.eval(idx), r.eval(idx)); }
+        };
+
+        /** @brief A tensor leaf. It keeps a copy of the Tensor, so views made inline stay alive. */
+        struct TensorExpr : Expression<TensorExpr> 
+        {
+            Tensor tensor;
+            static constexpr uint64_t ops = 0;
+
+            void collect(std::vector<const Tensor*>& leaves) const { leaves.push_back(&tensor); }
+
+            template<typename T>
+            BoundTensor<T> bind(const Tensor& out, bool& flat) const 
+            {
+                BoundTensor<T> b{static_cast<const T*>(tensor.data()), true, out.rank, {}};
+                b.flat = leaf_strides(tensor, out, b.strides);
+                flat = flat && b.flat;
+                return b;
+            }
+        };
+
+        /** @brief A constant. It is kept as double and converted to the element type of the output. */
+        struct ScalarExpr : Expression<ScalarExpr> 
+        {
+            double value;
+            static constexpr uint64_t ops = 0;
+
+            void collect(std::vector<const Tensor*>&) const {}
+
+            template<typename T>
+            BoundScalar<T> bind(const Tensor&, bool&) const { return {T(value)}; }
+        };
+
+        template<typename Op, typename E>
+        struct UnaryExpr : Expression<UnaryExpr<Op, E>> 
+        {
+            E e;
+            Op op;
+            static constexpr uint64_t ops = E::ops + 1;
+
+            void collect(std::vector<const Tensor*>& leaves) const { e.collect(leaves); }
+
+            template<typename T>
+            auto bind(const Tensor& out, bool& flat) const 
+            {
+                auto be = e.template bind<T>(out, flat);
+                auto bop = bind_op<T>(op);
+                return BoundUnary<decltype(bop), decltype(be)>{bop, be};
+            }
+        };
+
+        template<typename Op, typename L, typename R>
+        struct BinaryExpr : Expression<BinaryExpr<Op, L, R>> 
+        {
+            L l;
+            R r;
+            static constexpr uint64_t ops = L::ops + R::ops + 1;
+
+            void collect(std::vector<const Tensor*>& leaves) const 
+            { 
+                l.collect(leaves);
+                r.collect(leaves);
+            }
+
+            template<typename T>
+            auto bind(const Tensor& out, bool& flat) const 
+            {
+                auto bl = l.template bind<T>(out, flat);
+                auto br = r.template bind<T>(out, flat);
+                return BoundBinary<Op, decltype(bl), decltype(br)>{Op{}, bl, br};
+            }
+        };
+
+        template<typename T>
+        concept ExpressionNode = std::is_base_of_v<Expression<std::decay_t<T>>, std::decay_t<T>>;
+
+        template<typename T>
+        concept Operand = ExpressionNode<T> || std::same_as<std::decay_t<T>, Tensor> || std::is_arithmetic_v<std::decay_t<T>>;
+
+        /** @brief True if at least one side is a tensor or an expression, so plain numbers keep their own operators. */
+        template<typename L, typename R>
+        concept Operands = Operand<L> && Operand<R> && !(std::is_arithmetic_v<std::decay_t<L>> && std::is_arithmetic_v<std::decay_t<R>>);
+
+        template<typename T>
+        auto as_expr(const T& x)
+        {
+            if constexpr (ExpressionNode<T>) return x;
+            else if constexpr (std::is_same_v<T, Tensor>) return TensorExpr{{}, x};
+            else return ScalarExpr{{}, static_cast<double>(x)};
+        }
+
+        template<typename Op, typename L, typename R>
+        auto make_binary(const L& l, const R& r)
+        {
+            auto el = as_expr(l);
+            auto er = as_expr(r);
+            return BinaryExpr<Op, decltype(el), decltype(er)>{{}, el, er};
+        }
+    } // namespace Expr
+
+    /** @brief Start an expression from a tensor, e.g. `expr(A).exp()`. */
+    inline Expr::TensorExpr expr(const Tensor& t) { return Expr::TensorExpr{{}, t}; }
+
+    /** @brief Lazy elementwise A + B. Either side can be a tensor, an expression or a number. */
+    template<typename L, typename R> requires Expr::Operands<L, R>
+    auto operator+(const L& l, const R& r) { return Expr::make_binary<Expr::Add>(l, r); }
+
+    /** @brief Lazy elementwise A - B. */
+    template<typename L, typename R> requires Expr::Operands<L, R>
+    auto operator-(const L& l, const R& r) { return Expr::make_binary<Expr::Sub>(l, r); }
+
+    /** @brief Lazy elementwise A * B. */
+    template<typename L, typename R> requires Expr::Operands<L, R>
+    auto operator*(const L& l, const R& r) { return Expr::make_binary<Expr::Mul>(l, r); }
+
+    /** @brief Lazy elementwise A / B. */
+    template<typename L, typename R> requires Expr::Operands<L, R>
+    auto operator/(const L& l, const R& r) { return Expr::make_binary<Expr::Div>(l, r); }
+
+    template<typename E>
+    sycl::event Engine::assign(Tensor& out, const Expression<E>& expression)
+    {
+        using namespace SushiRuntime::Graph::Literals;
+
+        const E& e = expression.derived();
+        SB_THROW_IF(out.dtype != Core::DataType::HALF && out.dtype != Core::DataType::FLOAT32 && out.dtype != Core::DataType::FLOAT64,
+                    "Expressions support only half, float and double outputs.");
+
+        std::vector<const Tensor*> leaves;
+        e.collect(leaves);
+
+        std::vector<AccessRange> reads;
+        reads.reserve(leaves.size());
+        uint64_t elements = static_cast<uint64_t>(out.num_elements);
+        for (const Tensor* leaf : leaves)
+        {
+            SB_THROW_IF(leaf->dtype != out.dtype, "Expression leaves must have the data type of the output.");
+            reads.push_back(leaf->access_range());
+            SB_THROW_IF(reads.back().overlaps(out.access_range()) && !Expr::reads_in_place(*leaf, out),
+                        "An expression leaf shares memory with the output but reads it in a different order. Assign to a separate tensor.");
+            elements += static_cast<uint64_t>(leaf->num_elements);
+        }
+        AccessRange writes[] = {out.access_range()};
+
+        SushiRuntime::Graph::TaskMetadata meta;
+        meta.name = "math.ew.expression";
+        meta.task_type = SushiRuntime::Graph::TaskType::MATH_OP;
+        meta.op_id = "math.ew.expression"_op;
+        meta.set_param(0, static_cast<uint32_t>(E::ops));
+
+        int64_t size = out.num_elements;
+        OpCost cost = {static_cast<uint64_t>(size) * E::ops, elements * Core::element_size(out.dtype)};
+
+        auto enqueue = [&]<typename T>(T*)
+        {
+            int64_t out_strides[Core::MAX_TENSOR_RANK] = {};
+            bool flat = Expr::leaf_strides(out, out, out_strides);
+            auto bound = e.template bind<T>(out, flat);
+
+            struct OutShape { int32_t rank; int64_t shape[Core::MAX_TENSOR_RANK]; int64_t strides[Core::MAX_TENSOR_RANK]; } shape{out.rank, {}, {}};
+            for (int d = 0; d < out.rank; ++d)
+            {
+                shape.shape[d] = out.shape[d];
+                shape.strides[d] = out_strides[d];
+            }
+
+            add_task(meta, reads, writes,
+                [size, flat, shape, bound, pOut = static_cast<T*>(out.data())](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
+                {
+                    SB_LOG_INFO("Elementwise expression: {} ops, {} elements", E::ops, size);
+                    return q.submit([&](sycl::handler& h) 
+                    {
+                        h.depends_on(deps);
+                        h.parallel_for(sycl::range<1>(size), [=](sycl::id<1> i) 
+                        {
+                            ExprIndex idx;
+                            idx.linear = static_cast<int64_t>(i[0]);
+                            if (flat)
+                            {
+                                pOut[idx.linear] = static_cast<T>(bound.eval(idx));
+                                return;
+                            }
+
+                            int64_t rest = idx.linear;
+                            int64_t offset = 0;
+                            for (int d = shape.rank - 1; d >= 0; --d)
+                            {
+                                idx.coord[d] = rest % shape.shape[d];
+                                rest /= shape.shape[d];
+                                offset += idx.coord[d] * shape.strides[d];
+                            }
+                            pOut[offset] = static_cast<T>(bound.eval(idx));
+                        });
+                    });
+                }, {}, cost);
+        };
+
+        switch (out.dtype)
+        {
+            case Core::DataType::HALF:    enqueue((sycl::half*)nullptr); break;
+            case Core::DataType::FLOAT32: enqueue((float*)nullptr); break;
+            case Core::DataType::FLOAT64: enqueue((double*)nullptr); break;
+            default: break;
+        }
+        return sycl::event();
+    }
+} // namespace SushiBLAS
@@ -64,6 +64,23 @@ namespace SushiBLAS
             /** @brief The strategy used for memory allocation (Shared, Device, or Host). */
             SushiRuntime::Memory::AllocStrategy strategy;                          
 
+            /** @brief The NUMA node the memory was allocated on, or -1 if it is not known. */
+            int numa_node = -1;
+
+            /** 
+             * @brief The start of the allocation that holds the data.
+             * 
+             * It is data_ptr, unless the storage is a view into a shared arena. 
+             * Access ranges use it, so views of one arena are tracked as one allocation.
+             */
+            void* alloc_base = nullptr;
+
+            /** @brief The byte offset of data_ptr from alloc_base. */
+            size_t alloc_offset = 0;
+
+            /** @brief The arena this storage is a view of, or null if it owns its memory. */
+            SushiRuntime::sushi_ptr<Storage> parent;
+
             /**
             * @brief Create a new Storage object.
             * 
@@ -92,12 +109,38 @@ namespace SushiBLAS
 
                 data_ptr = allocator->allocate(size_bytes, strategy);
                 SB_THROW_IF(!data_ptr, "Allocation failed for {} bytes", size_bytes);
+                alloc_base = data_ptr;
+            }
+
+            /**
+            * @brief Create a view of a part of another storage.
+            * 
+            * The view does not allocate. It keeps the arena alive and never frees its memory.
+            * 
+            * @param arena The storage that owns the memory.
+            * @param offset The byte offset of the view inside the arena.
+            * @param n_bytes The size of the view in bytes.
+            * @throws std::runtime_error If the view does not fit in the arena.
+            */
+            Storage(SushiRuntime::sushi_ptr<Storage> arena, size_t offset, size_t n_bytes)
+                : size_bytes(n_bytes), requested_bytes(n_bytes), allocator(arena->allocator), 
+                  strategy(arena->strategy), numa_node(arena->numa_node), parent(arena)
+            {
+                SB_THROW_IF(offset + n_bytes > arena->size_bytes, 
+                            "View of {} bytes at offset {} does not fit in a storage of {} bytes", n_bytes, offset, arena->size_bytes);
+
+                data_ptr = static_cast<char*>(arena->data_ptr) + offset;
+                alloc_base = arena->alloc_base;
+                alloc_offset = arena->alloc_offset + offset;
             }
 
             Storage(const Storage&) = delete;
             Storage& operator=(const Storage&) = delete;
 
         protected:
+            /** @brief Create an empty storage. Used by subclasses that get their memory elsewhere. */
+            Storage() : strategy(SushiRuntime::Memory::AllocStrategy::HOST) {}
+
             /** 
              * @brief Destroy the Storage object.
              * 
@@ -105,7 +148,7 @@ namespace SushiBLAS
              */
             ~Storage() override 
             {
-                if (data_ptr && allocator) 
+                if (data_ptr && allocator && !parent) 
                 {
                     allocator->deallocate(data_ptr);
                 }
@@ -41,6 +41,7 @@
 #include <SushiBLAS/core/common.hpp>
 #include <SushiBLAS/core/logger.hpp>
 #include <SushiRuntime/SushiRuntime.h>
+#include <SushiBLAS/graph/access_range.hpp>
 
 namespace SushiBLAS 
 {
@@ -87,11 +88,13 @@ namespace SushiBLAS
          * @param dims A list of sizes for each dimension.
          * @param offset The starting position in the storage.
          * @param l The memory layout (default is ROW_MAJOR).
+         * @param type The data type, used to check the storage size (default is FLOAT32).
          * @throws std::runtime_error If the rank is too high or storage is too small.
          */
         Tensor(SushiRuntime::sushi_ptr<Storage> s, std::span<const int64_t> dims, 
-               int64_t offset = 0, Core::Layout l = Core::Layout::ROW_MAJOR) 
-            : rank(static_cast<int32_t>(dims.size())), layout(l), storage(s), storage_offset(offset)
+               int64_t offset = 0, Core::Layout l = Core::Layout::ROW_MAJOR,
+               Core::DataType type = Core::DataType::FLOAT32) 
+            : rank(static_cast<int32_t>(dims.size())), dtype(type), layout(l), storage(s), storage_offset(offset)
         {
             SB_THROW_IF(static_cast<size_t>(rank) > SushiBLAS::Core::MAX_TENSOR_RANK, "Rank {} exceeds limit of {}", rank, SushiBLAS::Core::MAX_TENSOR_RANK);
 
@@ -120,7 +123,7 @@ namespace SushiBLAS
             {
                 SB_THROW_IF(storage_offset < 0, "Storage offset cannot be negative ({})", storage_offset);
 
-                size_t required_bytes = (static_cast<size_t>(num_elements) + storage_offset) * sizeof(float);
+                size_t required_bytes = (static_cast<size_t>(num_elements) + storage_offset) * Core::element_size(dtype);
                 
                 SB_THROW_IF(required_bytes > storage->size_bytes, 
                             "Storage capacity exceeded! Required: {} bytes, Available: {} bytes", 
@@ -135,10 +138,12 @@ namespace SushiBLAS
          * @param dims Example: {3, 3} for a 3x3 matrix.
          * @param offset Starting position in storage.
          * @param l Memory layout strategy.
+         * @param type The data type.
          */
         Tensor(SushiRuntime::sushi_ptr<Storage> s, std::initializer_list<int64_t> dims, 
-               int64_t offset = 0, Core::Layout l = Core::Layout::ROW_MAJOR)
-            : Tensor(s, std::span<const int64_t>(dims.begin(), dims.end()), offset, l) {}
+               int64_t offset = 0, Core::Layout l = Core::Layout::ROW_MAJOR,
+               Core::DataType type = Core::DataType::FLOAT32)
+            : Tensor(s, std::span<const int64_t>(dims.begin(), dims.end()), offset, l, type) {}
 
         /**
          * @brief Get the hardware device (GPU/CPU) where this tensor lives.
@@ -162,8 +167,43 @@ namespace SushiBLAS
             SB_THROW_IF(storage->data_ptr == nullptr, "Accessing data of a tensor with no data pointer");
 
             // Offset is in terms of elements, so we must scale by byte size of the dtype
-            size_t element_size = (dtype == Core::DataType::FLOAT64) ? 8 : 4; 
-            return static_cast<char*>(storage->data_ptr) + (storage_offset * element_size);
+            return static_cast<char*>(storage->data_ptr) + (storage_offset * Core::element_size(dtype));
+        }
+
+        /**
+         * @brief Get the bytes of the storage that this view can touch.
+         * 
+         * The range goes from the first element to one past the last element 
+         * that the shape and strides can reach. Operations pass it to the Engine 
+         * so that only overlapping views create dependencies.
+         * @return The byte range, or an empty range if the tensor has no storage.
+         */
+        inline AccessRange access_range() const 
+        {
+            if (!storage || storage->data_ptr == nullptr || num_elements == 0) return AccessRange(nullptr, 0, 0);
+
+            int64_t last = 0;
+            for (int i = 0; i < rank; ++i)
+                last += (shape[i] - 1) * strides[i];
+
+            size_t bpe = Core::element_size(dtype);
+            size_t first = static_cast<size_t>(storage_offset) * bpe;
+            first += storage->alloc_offset;
+            return AccessRange(storage->alloc_base, first, first + (static_cast<size_t>(last) + 1) * bpe, storage->numa_node);
+        }
+
+        /**
+         * @brief Get the first num_elements elements of the storage as a byte range.
+         * 
+         * Use this for kernels that index storage->data_ptr as a flat array and 
+         * ignore the offset and strides of the view.
+         * @return The byte range, or an empty range if the tensor has no storage.
+         */
+        inline AccessRange flat_access_range() const 
+        {
+            if (!storage || storage->data_ptr == nullptr) return AccessRange(nullptr, 0, 0);
+            size_t first = storage->alloc_offset;
+            return AccessRange(storage->alloc_base, first, first + static_cast<size_t>(num_elements) * Core::element_size(dtype), storage->numa_node);
         }
 
         /**
@@ -266,12 +306,14 @@ namespace SushiBLAS
 
             SB_LOG_DEBUG("Tensor Reshaped: elements={}", new_len);
 
-            return Tensor(this->storage, dims_span, this->storage_offset, this->layout);
+            return Tensor(this->storage, dims_span, this->storage_offset, this->layout, this->dtype);
         }
 
         /**
          * @brief Take a "slice" or sub-section of the tensor.
          * 
+         * This is a "view" operation. The slice keeps the strides of the tensor, so 
+         * a slice of a non-leading dimension is usually not contiguous.
          * @param dim The dimension to slice (e.g., slice certain rows).
          * @param start The starting index (inclusive).
          * @param end The ending index (exclusive).
@@ -288,15 +330,16 @@ namespace SushiBLAS
             start = std::max<int64_t>(0, std::min(start, dim_size));
             end = std::max<int64_t>(start, std::min(end, dim_size));
 
-            int64_t new_offset = this->storage_offset + (start * strides[dim]);
-            
-            std::array<int64_t, SushiBLAS::Core::MAX_TENSOR_RANK> new_shape_arr = shape;
-            new_shape_arr[dim] = end - start;
+            // a view keeps the parent's strides, only the offset and one extent change
+            Tensor t = *this;
+            t.storage_offset = this->storage_offset + (start * strides[dim]);
+            t.shape[dim] = end - start;
+            t.num_elements = dim_size == 0 ? 0 : (num_elements / dim_size) * (end - start);
 
             SB_LOG_DEBUG("Tensor Sliced: dim = {}, range = [{}, {}), new_offset = {}", 
-                        dim, start, end, new_offset);
+                        dim, start, end, t.storage_offset);
 
-            return Tensor(this->storage, std::span(new_shape_arr.data(), rank), new_offset, this->layout);
+            return t;
         }
     };
 } // namespace SushiBLAS
\ No newline at end of file
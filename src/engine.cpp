@@ -28,17 +28,41 @@
 /* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
 /**************************************************************************/
 
+#include <algorithm>
 #include <SushiBLAS/engine.hpp>
 
 namespace SushiBLAS 
 {
+    namespace 
+    {
+        // one token per runtime shard, so token edges never share a tracker lock.
+        // Epochs hold at most this many tasks, so no two tasks of one epoch share a token.
+        constexpr size_t TOKEN_SLOTS = Engine::MAX_EPOCH_TASKS;
+        constexpr size_t TOKEN_STRIDE = 64;
+
+        bool is_complete(const sycl::event& e)
+        {
+            return e.get_info<sycl::info::event::command_execution_status>() == sycl::info::event_command_status::complete;
+        }
+    } // namespace Anonymous
+
     Engine::Engine(SushiRuntime::Execution::RuntimeContext& ctx, Core::Layout layout) 
-        : context_(ctx), graph_(ctx), default_layout_(layout) 
+        : context_(ctx), graph_(ctx), default_layout_(layout), epoch_arena_(std::make_unique<TaskArena>()), 
+          tokens_(TOKEN_SLOTS * TOKEN_STRIDE)
     {
         SB_LOG_INFO("SushiBLAS Engine initialized with {} layout.", 
                     layout == Core::Layout::ROW_MAJOR ? "Row-Major" : "Column-Major");
     }
 
+    Engine::~Engine()
+    {
+        // the runtime may still call work closures that live in these arenas
+        for (auto& retired : retired_arenas_)
+            retired.done.wait();
+
+        io_worker_.wait_idle();
+    }
+
     Tensor Engine::create_tensor(std::initializer_list<int64_t> dims, 
                                  SushiRuntime::Memory::AllocStrategy strat)
     {
@@ -48,6 +72,14 @@ namespace SushiBLAS
     Tensor Engine::create_tensor(std::initializer_list<int64_t> dims, 
                                  Core::DataType dtype,
                                  SushiRuntime::Memory::AllocStrategy strat)
+    {
+        return create_tensor_on_node(dims, dtype, -1, strat);
+    }
+
+    Tensor Engine::create_tensor_on_node(std::initializer_list<int64_t> dims, 
+                                         Core::DataType dtype,
+                                         int numa_id,
+                                         SushiRuntime::Memory::AllocStrategy strat)
     {
         size_t elements = 1;
 
@@ -60,12 +92,549 @@ namespace SushiBLAS
         else if (dtype == Core::DataType::COMPLEX64) bpe = 16;
         else if (dtype == Core::DataType::HALF) bpe = 2;
 
-        auto storage = SushiRuntime::make_sushi<Storage>(context_.get_allocator(), elements * bpe, strat);
+        SushiRuntime::sushi_ptr<Storage> storage;
+        if (planning_ && capturing_)
+        {
+            SB_THROW_IF(plan_next_ >= plan_storages_.size(), "Planned capture created more tensors than on its first pass.");
+            storage = plan_storages_[plan_next_++];
+            SB_THROW_IF(storage && storage->size_bytes < elements * bpe, 
+                        "Planned capture created a tensor of {} bytes where the first pass had {}.", elements * bpe, storage->size_bytes);
+        }
+
+        if (!storage)
+        {
+            storage = SushiRuntime::make_sushi<Storage>(tensor_allocator(numa_id), elements * bpe, strat);
+            storage->numa_node = numa_id;
+        }
         
-        Tensor t(storage, dims, 0, default_layout_);
-        t.dtype = dtype;
+        Tensor t(storage, dims, 0, default_layout_, dtype);
+
+        // tensors created inside a capture are owned by the captured graph as well
+        if (capturing_) captured_storages_.push_back(storage);
 
         return t;
     }
 
+    SushiRuntime::sushi_ptr<CachingAllocator> Engine::tensor_allocator(int numa_id)
+    {
+        size_t index = static_cast<size_t>(numa_id + 1);
+        if (index >= tensor_allocators_.size()) 
+            tensor_allocators_.resize(index + 1);
+
+        auto& allocator = tensor_allocators_[index];
+        if (!allocator)
+        {
+            auto upstream = numa_id < 0 ? context_.get_allocator() : context_.get_allocator(numa_id);
+            allocator = SushiRuntime::make_sushi<CachingAllocator>(upstream);
+        }
+        return allocator;
+    }
+
+    MemoryStats Engine::memory_stats() const
+    {
+        MemoryStats total;
+        for (const auto& allocator : tensor_allocators_)
+        {
+            if (!allocator) continue;
+            MemoryStats s = allocator->stats();
+            total.in_use_bytes += s.in_use_bytes;
+            total.peak_bytes += s.peak_bytes;
+            total.cached_bytes += s.cached_bytes;
+            total.reserved_bytes += s.reserved_bytes;
+            total.hits += s.hits;
+            total.misses += s.misses;
+        }
+        return total;
+    }
+
+    size_t Engine::trim_memory()
+    {
+        size_t freed = 0;
+        for (auto& allocator : tensor_allocators_)
+            if (allocator) freed += allocator->trim();
+        return freed;
+    }
+
+    sycl::event Engine::execute()
+    {
+        sycl::event done = flush_pending();
+        if (!streamed_) return done;
+
+        // automatic flushes may not be ordered before this one, so join every running epoch
+        streamed_ = false;
+        std::vector<sycl::event> running(epoch_events_.begin(), epoch_events_.end());
+        return context_.get_queue().ext_oneapi_submit_barrier(running);
+    }
+
+    void Engine::stream_pending()
+    {
+        const TaskRecord& rec = pending_tasks_.back();
+        pending_bytes_ += task_bytes(rec);
+
+        bool full = pending_tasks_.size() >= MAX_EPOCH_TASKS || 
+                    (streaming_.max_tasks > 0 && pending_tasks_.size() >= streaming_.max_tasks) || 
+                    (streaming_.max_bytes > 0 && pending_bytes_ >= streaming_.max_bytes);
+
+        if (streaming_.max_delay.count() > 0)
+        {
+            auto now = std::chrono::steady_clock::now();
+            if (pending_tasks_.size() == 1) pending_since_ = now;
+            full = full || now - pending_since_ >= streaming_.max_delay;
+        }
+
+        if (!full) return;
+
+        // back pressure, so a fast producer does not queue unbounded work on the device
+        if (streaming_.max_in_flight > 0)
+        {
+            while (epoch_events_.size() >= streaming_.max_in_flight)
+            {
+                epoch_events_.front().wait();
+                epoch_events_.pop_front();
+                ++first_epoch_;
+            }
+        }
+
+        flush_pending();
+        streamed_ = true;
+    }
+
+    sycl::event Engine::flush_pending()
+    {
+        pending_bytes_ = 0;
+
+        if (fusion_enabled_)
+            fuse_elementwise(pending_tasks_, *epoch_arena_);
+
+        retire_finished_epochs();
+        build_epoch_graph();
+        if (profiling_enabled_)
+            profiler_.instrument(pending_tasks_, *epoch_arena_);
+        if (stats_enabled_)
+        {
+            stats_.collect();
+            stats_.instrument(pending_tasks_, *epoch_arena_);
+        }
+        place_tasks(pending_tasks_, *epoch_arena_);
+        sycl::event done = execution_mode_ == Core::ExecutionMode::EVENT_DRIVEN ? submit_event_driven() : submit_scheduled();
+
+        push_epoch(pending_tasks_, done);
+        pending_tasks_.clear();
+
+        // the epoch's closures must live until the runtime has run them
+        if (epoch_arena_->bytes_used() > 0)
+        {
+            retired_arenas_.push_back({std::move(epoch_arena_), done});
+            epoch_arena_ = acquire_arena();
+        }
+
+        return done;
+    }
+
+    void Engine::retire_finished_epochs()
+    {
+        // epochs that already finished can not conflict with anything
+        while (!epoch_events_.empty() && is_complete(epoch_events_.front()))
+        {
+            epoch_events_.pop_front();
+            ++first_epoch_;
+        }
+        history_.erase_before(first_epoch_);
+    }
+
+    void Engine::push_epoch(std::span<const TaskRecord> tasks, const sycl::event& done)
+    {
+        uint32_t epoch = first_epoch_ + static_cast<uint32_t>(epoch_events_.size());
+        for (const TaskRecord& task : tasks)
+            history_.insert(epoch, task.reads, task.writes);
+        epoch_events_.push_back(done);
+
+        // tensor memory freed from now on is only reused once the running epochs are done
+        if (!tensor_allocators_.empty())
+        {
+            std::vector<sycl::event> running(epoch_events_.begin(), epoch_events_.end());
+            for (auto& allocator : tensor_allocators_)
+                if (allocator) allocator->set_fence(running);
+        }
+    }
+
+    sycl::event Engine::launch_graph(ExecutableGraph& graph)
+    {
+        SB_THROW_IF(capturing_, "An executable graph can not be launched while a capture is active.");
+
+        // tasks queued before the launch run before it
+        if (!pending_tasks_.empty()) execute();
+
+        retire_finished_epochs();
+
+        flush_preds_.clear();
+        for (const TaskRecord& rec : graph.records_)
+            history_.collect(rec.reads, rec.writes, flush_preds_);
+        std::sort(flush_preds_.begin(), flush_preds_.end());
+        flush_preds_.erase(std::unique(flush_preds_.begin(), flush_preds_.end()), flush_preds_.end());
+
+        flush_deps_.clear();
+        for (uint32_t epoch : flush_preds_)
+            flush_deps_.push_back(epoch_events_[epoch - first_epoch_]);
+
+        // the launch is an epoch of its own, so later work and freed memory wait for it
+        sycl::event done = graph.submit(flush_deps_);
+        push_epoch(graph.records_, done);
+        return done;
+    }
+
+    void Engine::build_epoch_graph()
+    {
+        build_task_edges(pending_tasks_, epoch_tracker_, epoch_pred_offsets_, epoch_preds_);
+        priority_order(pending_tasks_, epoch_pred_offsets_, epoch_preds_, flush_order_);
+    }
+
+    sycl::event Engine::submit_scheduled()
+    {
+        task_tokens_.resize(pending_tasks_.size());
+
+        // the runtime takes vectors, so reuse scratch vectors instead of building new ones
+        for (uint32_t i : flush_order_)
+        {
+            TaskRecord& task = pending_tasks_[i];
+            task_tokens_[i] = tokens_.data() + (next_token_++ % TOKEN_SLOTS) * TOKEN_STRIDE;
+
+            // tasks of this epoch are ordered by their tokens
+            flush_reads_.clear();
+            for (uint32_t p = epoch_pred_offsets_[i]; p < epoch_pred_offsets_[i + 1]; ++p)
+                flush_reads_.push_back(task_tokens_[epoch_preds_[p]]);
+            flush_writes_.assign(1, task_tokens_[i]);
+
+            // tasks of earlier epochs are ordered by their done events
+            collect_history_deps(i);
+
+            graph_.add_task(task.meta, flush_reads_, flush_writes_, std::move(task.work), flush_deps_);
+        }
+
+        return graph_.execute();
+    }
+
+    sycl::event Engine::submit_event_driven()
+    {
+        sycl::queue& queue = context_.get_queue();
+        task_events_.resize(pending_tasks_.size());
+        has_successor_.assign(pending_tasks_.size(), 0);
+
+        for (uint32_t i : flush_order_)
+        {
+            collect_history_deps(i);
+
+            for (uint32_t p = epoch_pred_offsets_[i]; p < epoch_pred_offsets_[i + 1]; ++p)
+            {
+                flush_deps_.push_back(task_events_[epoch_preds_[p]]);
+                has_successor_[epoch_preds_[p]] = 1;
+            }
+
+            task_events_[i] = pending_tasks_[i].work(queue, flush_deps_);
+        }
+
+        // only the last task of each chain needs to be joined
+        flush_deps_.clear();
+        for (uint32_t i = 0; i < pending_tasks_.size(); ++i)
+            if (!has_successor_[i]) flush_deps_.push_back(task_events_[i]);
+
+        return queue.ext_oneapi_submit_barrier(flush_deps_);
+    }
+
+    void Engine::collect_history_deps(uint32_t task)
+    {
+        const TaskRecord& rec = pending_tasks_[task];
+
+        flush_preds_.clear();
+        history_.collect(rec.reads, rec.writes, flush_preds_);
+        std::sort(flush_preds_.begin(), flush_preds_.end());
+        flush_preds_.erase(std::unique(flush_preds_.begin(), flush_preds_.end()), flush_preds_.end());
+
+        flush_deps_.clear();
+        for (uint32_t epoch : flush_preds_)
+            flush_deps_.push_back(epoch_events_[epoch - first_epoch_]);
+    }
+
+    void Engine::place_tasks(std::vector<TaskRecord>& tasks, TaskArena& arena)
+    {
+        if (lane_queues_.size() > 1)
+            assign_lanes(tasks, epoch_pred_offsets_, epoch_preds_, lane_queues_.size(), task_lanes_);
+
+        for (uint32_t i = 0; i < tasks.size(); ++i)
+        {
+            sycl::queue* queue = nullptr;
+
+            // data locality wins over spreading branches
+            int node = home_numa_node(tasks[i], numa_mapper_);
+            if (node >= 0)
+                queue = &numa_queue(node);
+            else if (lane_queues_.size() > 1)
+                queue = &lane_queues_[task_lanes_[i]];
+            else if (profiling_queue_)
+                queue = &*profiling_queue_;
+
+            if (!queue) continue;
+
+            // the work ignores the queue it is given and runs on the chosen one. The queue 
+            // handle is copied, so captured graphs stay valid if the lanes are rebuilt.
+            tasks[i].work = make_arena_work(arena, 
+                [work = std::move(tasks[i].work), target = *queue]
+                (sycl::queue&, const std::vector<sycl::event>& deps) mutable -> sycl::event 
+                {
+                    return work(target, deps);
+                });
+        }
+    }
+
+    sycl::queue& Engine::numa_queue(int node)
+    {
+        if (static_cast<size_t>(node) >= numa_queues_.size()) 
+            numa_queues_.resize(node + 1);
+
+        std::optional<sycl::queue>& queue = numa_queues_[node];
+        if (!queue)
+        {
+            // stats and the profiler need kernel times, so they get a profiling queue on the same device
+            sycl::queue& local = context_.get_numa_local_queue(node);
+            if (profiling_queue_)
+                queue.emplace(local.get_context(), local.get_device(), sycl::property::queue::enable_profiling{});
+            else
+                queue = local;
+        }
+        return *queue;
+    }
+
+    size_t Engine::set_lane_count(size_t lanes)
+    {
+        lane_queues_.clear();
+        if (lanes <= 1) return 1;
+
+        sycl::queue& main = context_.get_queue();
+        sycl::device device = main.get_device();
+        std::vector<sycl::device> subs;
+
+        // one sub-device per affinity domain (NUMA node or shared cache), else equal slices of cores
+        try
+        {
+            subs = device.create_sub_devices<sycl::info::partition_property::partition_by_affinity_domain>(
+                sycl::info::partition_affinity_domain::next_partitionable);
+
+            if (subs.size() < 2)
+            {
+                size_t units = device.get_info<sycl::info::device::max_compute_units>();
+                subs = device.create_sub_devices<sycl::info::partition_property::partition_equally>(std::max<size_t>(1, units / lanes));
+            }
+        }
+        catch (const sycl::exception& e)
+        {
+            SB_LOG_WARN("Device can not be partitioned into lanes: {}", e.what());
+            subs.clear();
+        }
+
+        if (subs.size() < 2)
+        {
+            SB_LOG_WARN("Lane count {} requested, running on a single queue.", lanes);
+            return 1;
+        }
+
+        // lanes share the main context, so USM memory and events work across them
+        size_t count = std::min(lanes, subs.size());
+        lane_queues_.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (profiling_queue_)
+                lane_queues_.emplace_back(main.get_context(), subs[i], sycl::property::queue::enable_profiling{});
+            else
+                lane_queues_.emplace_back(main.get_context(), subs[i]);
+        }
+
+        SB_LOG_INFO("Engine running on {} lanes.", count);
+        return count;
+    }
+
+    void Engine::set_profiling_enabled(bool enabled)
+    {
+        if (enabled == profiling_enabled_) return;
+        profiling_enabled_ = enabled;
+        update_profiling_queues();
+
+        SB_LOG_INFO("Task profiling {}.", enabled ? "enabled" : "disabled");
+    }
+
+    void Engine::set_stats_enabled(bool enabled)
+    {
+        if (enabled == stats_enabled_) return;
+        stats_enabled_ = enabled;
+        update_profiling_queues();
+
+        SB_LOG_INFO("Op statistics {}.", enabled ? "enabled" : "disabled");
+    }
+
+    void Engine::update_profiling_queues()
+    {
+        bool wanted = profiling_enabled_ || stats_enabled_;
+        if (wanted == profiling_queue_.has_value()) return;
+
+        profiling_queue_.reset();
+        if (wanted)
+        {
+            sycl::queue& main = context_.get_queue();
+            profiling_queue_.emplace(main.get_context(), main.get_device(), sycl::property::queue::enable_profiling{});
+        }
+
+        // NUMA queues are made again on first use, lane queues right away, with or without the profiling property
+        numa_queues_.clear();
+        if (!lane_queues_.empty())
+            set_lane_count(lane_queues_.size());
+    }
+
+    std::unique_ptr<TaskArena> Engine::acquire_arena()
+    {
+        for (size_t i = 0; i < retired_arenas_.size(); ++i)
+        {
+            if (!is_complete(retired_arenas_[i].done)) continue;
+
+            std::unique_ptr<TaskArena> arena = std::move(retired_arenas_[i].arena);
+            retired_arenas_[i] = std::move(retired_arenas_.back());
+            retired_arenas_.pop_back();
+
+            arena->reset();
+            return arena;
+        }
+
+        return std::make_unique<TaskArena>();
+    }
+
+    void Engine::begin_capture()
+    {
+        SB_THROW_IF(capturing_, "A capture is already active on this engine.");
+
+        capturing_ = true;
+        capture_arena_ = std::make_unique<TaskArena>();
+        captured_tasks_.clear();
+        captured_storages_.clear();
+
+        SB_LOG_INFO("Engine capture started.");
+    }
+
+    ExecutableGraph Engine::end_capture()
+    {
+        SB_THROW_IF(!capturing_, "end_capture() called without an active capture.");
+
+        capturing_ = false;
+        planning_ = false;
+        SB_LOG_INFO("Engine capture finished: {} tasks recorded.", captured_tasks_.size());
+
+        if (fusion_enabled_)
+            fuse_elementwise(captured_tasks_, *capture_arena_);
+
+        build_task_edges(captured_tasks_, epoch_tracker_, epoch_pred_offsets_, epoch_preds_);
+        place_tasks(captured_tasks_, *capture_arena_);
+
+        return ExecutableGraph(context_.get_queue(), std::move(captured_tasks_), 
+                               std::move(captured_storages_), std::move(capture_arena_), this);
+    }
+
+    ExecutableGraph Engine::capture_planned(const std::function<void()>& body)
+    {
+        SB_THROW_IF(capturing_, "A capture is already active on this engine.");
+
+        // a throwing body or a mismatch between the passes must not leave the engine capturing
+        try
+        {
+            return run_planned_capture(body);
+        }
+        catch (...)
+        {
+            abort_capture();
+            throw;
+        }
+    }
+
+    void Engine::abort_capture()
+    {
+        capturing_ = false;
+        planning_ = false;
+        plan_next_ = 0;
+        plan_storages_.clear();
+        captured_tasks_.clear();
+        captured_storages_.clear();
+        capture_arena_.reset();
+        memory_plan_ = MemoryPlan{};
+    }
+
+    ExecutableGraph Engine::run_planned_capture(const std::function<void()>& body)
+    {
+        using SushiRuntime::Memory::AllocStrategy;
+
+        // first pass: record only, to learn which tensors are intermediates and when they are used
+        begin_capture();
+        body();
+
+        memory_plan_ = MemoryPlan{};
+        std::vector<PlannedBuffer>& buffers = memory_plan_.buffers;
+        buffers.resize(captured_storages_.size());
+        std::vector<AllocStrategy> strategies(captured_storages_.size());
+
+        for (size_t i = 0; i < captured_storages_.size(); ++i)
+        {
+            const Storage& s = *captured_storages_[i];
+            buffers[i].bytes = s.size_bytes;
+            strategies[i] = s.strategy;
+
+            // a tensor the caller kept is an output and needs its own memory
+            if (s.get_ref_count() == 1 && !s.parent && s.numa_node < 0) 
+                buffers[i].base = s.alloc_base;
+        }
+        compute_lifetimes(captured_tasks_, buffers);
+
+        capturing_ = false;
+        captured_tasks_.clear();
+        captured_storages_.clear();
+        capture_arena_.reset();
+
+        // one arena per allocation strategy
+        plan_storages_.assign(buffers.size(), nullptr);
+        for (AllocStrategy strat : {AllocStrategy::DEVICE, AllocStrategy::SHARED, AllocStrategy::HOST})
+        {
+            std::vector<PlannedBuffer> group;
+            std::vector<size_t> ids;
+            for (size_t i = 0; i < buffers.size(); ++i)
+            {
+                if (!buffers[i].base || strategies[i] != strat) continue;
+                group.push_back(buffers[i]);
+                ids.push_back(i);
+            }
+
+            size_t arena_bytes = assign_offsets(group, SushiRuntime::Core::DEFAULT_ALIGNMENT);
+            if (arena_bytes == 0) continue;
+
+            auto arena = SushiRuntime::make_sushi<Storage>(tensor_allocator(-1), arena_bytes, strat);
+            memory_plan_.arena_bytes += arena_bytes;
+
+            for (size_t k = 0; k < ids.size(); ++k)
+            {
+                buffers[ids[k]] = group[k];
+                if (!group[k].planned) continue;
+
+                memory_plan_.naive_bytes += group[k].bytes;
+                plan_storages_[ids[k]] = SushiRuntime::make_sushi<Storage>(arena, group[k].offset, group[k].bytes);
+            }
+        }
+
+        // second pass: the same tensors are created, the intermediates as views of the arenas
+        begin_capture();
+        planning_ = true;
+        plan_next_ = 0;
+        body();
+
+        size_t created = plan_next_;
+        planning_ = false;
+        plan_storages_.clear();
+        SB_THROW_IF(created != buffers.size(), "Planned capture created {} tensors, the first pass created {}.", created, buffers.size());
+
+        SB_LOG_INFO("Memory plan: {} bytes of intermediates placed in {} bytes.", memory_plan_.naive_bytes, memory_plan_.arena_bytes);
+        return end_capture();
+    }
+
 } // namespace SushiBLAS
@@ -0,0 +1,137 @@
+/**************************************************************************/
+/* executable_graph.cpp                                                   */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <SushiBLAS/engine.hpp>
+#include <SushiBLAS/core/logger.hpp>
+#include <SushiBLAS/graph/priority.hpp>
+#include <SushiBLAS/graph/range_tracker.hpp>
+#include <SushiBLAS/graph/executable_graph.hpp>
+
+namespace SushiBLAS 
+{
+    ExecutableGraph::ExecutableGraph(sycl::queue& queue, 
+                                     std::vector<TaskRecord> records, 
+                                     std::vector<SushiRuntime::sushi_ptr<Storage>> keep_alive,
+                                     std::unique_ptr<TaskArena> arena,
+                                     Engine* engine)
+        : queue_(&queue), engine_(engine), arena_(std::move(arena)), records_(std::move(records)), keep_alive_(std::move(keep_alive))
+    {
+        build_dependencies();
+        priority_order(records_, pred_offsets_, preds_, order_);
+        events_.resize(records_.size());
+
+        SB_LOG_INFO("Executable graph built: {} tasks, {} edges, {} sinks", 
+                    records_.size(), preds_.size(), sinks_.size());
+    }
+
+    ExecutableGraph::~ExecutableGraph()
+    {
+        last_launch_.wait();
+    }
+
+    ExecutableGraph& ExecutableGraph::operator=(ExecutableGraph&& other)
+    {
+        if (this == &other) return *this;
+
+        // the storages about to be released may still be in use by the last launch
+        last_launch_.wait();
+
+        queue_ = other.queue_;
+        engine_ = other.engine_;
+        arena_ = std::move(other.arena_);
+        records_ = std::move(other.records_);
+        keep_alive_ = std::move(other.keep_alive_);
+        pred_offsets_ = std::move(other.pred_offsets_);
+        preds_ = std::move(other.preds_);
+        order_ = std::move(other.order_);
+        sinks_ = std::move(other.sinks_);
+        events_ = std::move(other.events_);
+        deps_ = std::move(other.deps_);
+        sink_events_ = std::move(other.sink_events_);
+        last_launch_ = std::move(other.last_launch_);
+        other.last_launch_ = sycl::event();
+        return *this;
+    }
+
+    void ExecutableGraph::build_dependencies()
+    {
+        RangeTracker tracker;
+        build_task_edges(records_, tracker, pred_offsets_, preds_);
+
+        std::vector<bool> has_successor(records_.size(), false);
+        for (uint32_t p : preds_)
+            has_successor[p] = true;
+
+        sinks_.clear();
+        for (uint32_t i = 0; i < records_.size(); ++i)
+            if (!has_successor[i]) sinks_.push_back(i);
+    }
+
+    sycl::event ExecutableGraph::launch()
+    {
+        if (records_.empty()) return last_launch_;
+        SB_THROW_IF(queue_ == nullptr, "Executable graph has no queue to launch on.");
+
+        if (engine_ != nullptr) return engine_->launch_graph(*this);
+        return submit({});
+    }
+
+    sycl::event ExecutableGraph::submit(const std::vector<sycl::event>& deps)
+    {
+        // tasks on the critical path are submitted first
+        for (uint32_t i : order_)
+        {
+            deps_.clear();
+
+            uint32_t begin = pred_offsets_[i];
+            uint32_t end = pred_offsets_[i + 1];
+
+            // roots wait for the previous launch and the engine's conflicting work, all other tasks wait for them
+            if (begin == end) 
+            {
+                deps_.push_back(last_launch_);
+                deps_.insert(deps_.end(), deps.begin(), deps.end());
+            }
+            else
+                for (uint32_t p = begin; p < end; ++p)
+                    deps_.push_back(events_[preds_[p]]);
+
+            events_[i] = records_[i].work(*queue_, deps_);
+        }
+
+        sink_events_.clear();
+        for (uint32_t s : sinks_)
+            sink_events_.push_back(events_[s]);
+
+        last_launch_ = queue_->ext_oneapi_submit_barrier(sink_events_);
+        return last_launch_;
+    }
+
+} // namespace SushiBLAS
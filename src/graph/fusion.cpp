@@ -0,0 +1,365 @@
+/**************************************************************************/
+/* fusion.cpp                                                             */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <cstdint>
+#include <sycl/sycl.hpp>
+#include <SushiBLAS/core/logger.hpp>
+#include <SushiBLAS/graph/fusion.hpp>
+#include <SushiBLAS/graph/task_record.hpp>
+#include <SushiRuntime/graph/task_types.hpp>
+#include "../ops/vector_internal.hpp"
+
+namespace SushiBLAS 
+{
+    using namespace SushiRuntime::Graph::Literals;
+
+    namespace
+    {
+        /** @brief How many tasks the pass looks ahead to extend a chain. */
+        constexpr size_t FUSION_WINDOW = 64;
+
+        /** @brief Operations understood by the fused elementwise kernel. */
+        enum class MicroOp : uint8_t
+        {
+            NONE,
+
+            // Binary (chain head only)
+            ADD, SUB, MUL, DIV, MIN, MAX, FMOD, REMAINDER,
+
+            // Unary: elementwise
+            NEG, ABS, SQRT, SQUARE, RECIPROCAL, EXP, LOG, POW, CLAMP,
+            SIN, COS, TAN, ASIN, ACOS, ATAN, SINH, COSH, ASINH, ACOSH, ATANH,
+            CEIL, FLOOR, ROUND,
+
+            // Unary: nonlinear
+            RELU, LEAKY_RELU, ELU, SIGMOID, SILU, GELU, SOFTPLUS, TANH
+        };
+
+        /** @brief One unary step of a fused chain with its scalar parameters. */
+        struct MicroStep 
+        {
+            MicroOp op = MicroOp::NONE;
+            float p0 = 0.0f;
+            float p1 = 0.0f;
+        };
+
+        /** @brief A fused chain: an optional binary head followed by unary steps. */
+        struct FusedProgram 
+        {
+            MicroOp head = MicroOp::NONE;
+            uint32_t count = 0;
+            MicroStep steps[MAX_FUSED_OPS];
+        };
+
+        inline MicroOp to_micro_op(SushiRuntime::Graph::OpID id)
+        {
+            switch (id.value)
+            {
+                case "math.ew.add"_op.value: return MicroOp::ADD;
+                case "math.ew.sub"_op.value: return MicroOp::SUB;
+                case "math.ew.mul"_op.value: return MicroOp::MUL;
+                case "math.ew.div"_op.value: return MicroOp::DIV;
+                case "math.ew.min"_op.value: return MicroOp::MIN;
+                case "math.ew.max"_op.value: return MicroOp::MAX;
+                case "math.ew.fmod"_op.value: return MicroOp::FMOD;
+                case "math.ew.remainder"_op.value: return MicroOp::REMAINDER;
+
+                case "math.ew.neg"_op.value: return MicroOp::NEG;
+                case "math.ew.abs"_op.value: return MicroOp::ABS;
+                case "math.ew.sqrt"_op.value: return MicroOp::SQRT;
+                case "math.ew.square"_op.value: return MicroOp::SQUARE;
+                case "math.ew.reciprocal"_op.value: return MicroOp::RECIPROCAL;
+                case "math.ew.exp"_op.value: return MicroOp::EXP;
+                case "math.ew.log"_op.value: return MicroOp::LOG;
+                case "math.ew.pow"_op.value: return MicroOp::POW;
+                case "math.ew.clamp"_op.value: return MicroOp::CLAMP;
+                case "math.ew.sin"_op.value: return MicroOp::SIN;
+                case "math.ew.cos"_op.value: return MicroOp::COS;
+                case "math.ew.tan"_op.value: return MicroOp::TAN;
+                case "math.ew.asin"_op.value: return MicroOp::ASIN;
+                case "math.ew.acos"_op.value: return MicroOp::ACOS;
+                case "math.ew.atan"_op.value: return MicroOp::ATAN;
+                case "math.ew.sinh"_op.value: return MicroOp::SINH;
+                case "math.ew.cosh"_op.value: return MicroOp::COSH;
+                case "math.ew.asinh"_op.value: return MicroOp::ASINH;
+                case "math.ew.acosh"_op.value: return MicroOp::ACOSH;
+                case "math.ew.atanh"_op.value: return MicroOp::ATANH;
+                case "math.ew.ceil"_op.value: return MicroOp::CEIL;
+                case "math.ew.floor"_op.value: return MicroOp::FLOOR;
+                case "math.ew.round"_op.value: return MicroOp::ROUND;
+
+                case "math.nonlinear.relu"_op.value: return MicroOp::RELU;
+                case "math.nonlinear.leaky_relu"_op.value: return MicroOp::LEAKY_RELU;
+                case "math.nonlinear.elu"_op.value: return MicroOp::ELU;
+                case "math.nonlinear.sigmoid"_op.value: return MicroOp::SIGMOID;
+                case "math.nonlinear.silu"_op.value: return MicroOp::SILU;
+                case "math.nonlinear.gelu"_op.value: return MicroOp::GELU;
+                case "math.nonlinear.softplus"_op.value: return MicroOp::SOFTPLUS;
+                case "math.nonlinear.tanh"_op.value: return MicroOp::TANH;
+                default: return MicroOp::NONE;
+            }
+        }
+
+        inline bool is_binary(MicroOp op) { return op >= MicroOp::ADD && op <= MicroOp::REMAINDER; }
+        inline bool is_unary(MicroOp op) { return op >= MicroOp::NEG; }
+
+        template<typename T>
+        inline T apply_binary(MicroOp op, T a, T b)
+        {
+            switch (op)
+            {
+                case MicroOp::ADD: return a + b;
+                case MicroOp::SUB: return a - b;
+                case MicroOp::MUL: return a * b;
+                case MicroOp::DIV: return a / b;
+                case MicroOp::MIN: return sycl::min(a, b);
+                case MicroOp::MAX: return sycl::max(a, b);
+                case MicroOp::FMOD: return sycl::fmod(a, b);
+                case MicroOp::REMAINDER: return sycl::remainder(a, b);
+                default: return a;
+            }
+        }
+
+        // Every case must give the same result as the lambda of the original operation.
+        template<typename T>
+        inline T apply_unary(const MicroStep& s, T x)
+        {
+            switch (s.op)
+            {
+                case MicroOp::NEG: return -x;
+                case MicroOp::ABS: return sycl::fabs(x);
+                case MicroOp::SQRT: return sycl::sqrt(x);
+                case MicroOp::SQUARE: return x * x;
+                case MicroOp::RECIPROCAL: return T(1) / x;
+                case MicroOp::EXP: return sycl::exp(x);
+                case MicroOp::LOG: return sycl::log(x);
+                case MicroOp::POW: return sycl::pow(x, T(s.p0));
+                case MicroOp::CLAMP: return sycl::clamp(x, T(s.p0), T(s.p1));
+                case MicroOp::SIN: return sycl::sin(x);
+                case MicroOp::COS: return sycl::cos(x);
+                case MicroOp::TAN: return sycl::tan(x);
+                case MicroOp::ASIN: return sycl::asin(x);
+                case MicroOp::ACOS: return sycl::acos(x);
+                case MicroOp::ATAN: return sycl::atan(x);
+                case MicroOp::SINH: return sycl::sinh(x);
+                case MicroOp::COSH: return sycl::cosh(x);
+                case MicroOp::ASINH: return sycl::asinh(x);
+                case MicroOp::ACOSH: return sycl::acosh(x);
+                case MicroOp::ATANH: return sycl::atanh(x);
+                case MicroOp::CEIL: return sycl::ceil(x);
+                case MicroOp::FLOOR: return sycl::floor(x);
+                case MicroOp::ROUND: return sycl::round(x);
+                case MicroOp::RELU: return x > T(0) ? x : T(0);
+                case MicroOp::LEAKY_RELU: return x > T(0) ? x : x * T(s.p0);
+                case MicroOp::ELU: return x > T(0) ? x : T(s.p0) * (sycl::exp(x) - T(1));
+                case MicroOp::SIGMOID: return T(1) / (T(1) + sycl::exp(-x));
+                case MicroOp::SILU: return x / (T(1) + sycl::exp(-x));
+                case MicroOp::GELU:
+                {
+                    T inner = T(0.7978845608028654) * (x + T(0.044715) * x * x * x);
+                    return T(0.5) * x * (T(1) + sycl::tanh(inner));
+                }
+                case MicroOp::SOFTPLUS: return sycl::log(T(1) + sycl::exp(x));
+                case MicroOp::TANH: return sycl::tanh(x);
+                default: return x;
+            }
+        }
+
+        template<typename T>
+        sycl::event submit_fused(sycl::queue& q, const std::vector<sycl::event>& deps, 
+                                 const FusedProgram& prog, const FusionInfo& info)
+        {
+            bool vectorize = Internal::vector_aligned(info.out) && 
+                             (prog.head == MicroOp::NONE || (Internal::vector_aligned(info.lhs) && Internal::vector_aligned(info.rhs)));
+
+            return q.submit([&](sycl::handler& h) 
+            {
+                h.depends_on(deps);
+                auto chain = [=](T v)
+                {
+                    for (uint32_t s = 0; s < prog.count; ++s)
+                        v = apply_unary(prog.steps[s], v);
+                    return v;
+                };
+
+                T* pOut = (T*)info.out;
+                const T* pA = (const T*)info.lhs;
+                const T* pB = (const T*)info.rhs;
+
+                if (vectorize && prog.head == MicroOp::NONE)
+                    Internal::vector_for(h, info.size, pOut, chain, (const T*)pOut);
+                else if (vectorize)
+                    Internal::vector_for(h, info.size, pOut, [=](T a, T b) { return chain(apply_binary(prog.head, a, b)); }, pA, pB);
+                else
+                {
+                    h.parallel_for(sycl::range<1>(info.size), [=](sycl::id<1> i) 
+                    {
+                        T v = prog.head == MicroOp::NONE ? pOut[i] : apply_binary(prog.head, pA[i], pB[i]);
+                        pOut[i] = chain(v);
+                    });
+                }
+            });
+        }
+
+        /** @brief True if the task reads or writes any byte of the range. */
+        inline bool touches(const TaskRecord& rec, const AccessRange& range)
+        {
+            for (const AccessRange& r : rec.reads)
+                if (r.overlaps(range)) return true;
+            for (const AccessRange& w : rec.writes)
+                if (w.overlaps(range)) return true;
+            return false;
+        }
+
+        /** @brief True if the task is an in-place unary step on the same memory as the chain. */
+        inline bool extends_chain(const TaskRecord& rec, const FusionInfo& head)
+        {
+            const FusionInfo& f = rec.fusion;
+            return f.enabled && f.lhs == nullptr && f.out == head.out && 
+                   f.size == head.size && f.dtype == head.dtype && 
+                   is_unary(to_micro_op(rec.meta.op_id));
+        }
+
+        inline MicroStep make_step(const TaskRecord& rec)
+        {
+            MicroStep step;
+            step.op = to_micro_op(rec.meta.op_id);
+            step.p0 = rec.meta.get_param<float>(0);
+            step.p1 = rec.meta.get_param<float>(1);
+            return step;
+        }
+
+        TaskRecord build_fused_task(std::vector<TaskRecord>& tasks, const std::vector<size_t>& chain, TaskArena& arena)
+        {
+            TaskRecord& head = tasks[chain[0]];
+            MicroOp head_op = to_micro_op(head.meta.op_id);
+
+            FusedProgram prog;
+            size_t first_step = 0;
+            if (head.fusion.lhs != nullptr)
+            {
+                prog.head = head_op;
+                first_step = 1;
+            }
+
+            for (size_t k = first_step; k < chain.size(); ++k)
+                prog.steps[prog.count++] = make_step(tasks[chain[k]]);
+
+            TaskRecord fused;
+            fused.meta.name = "math.fused.elementwise";
+            fused.meta.task_type = SushiRuntime::Graph::TaskType::MATH_OP;
+            fused.meta.op_id = "math.fused.elementwise"_op;
+            fused.meta.set_param(0, static_cast<uint32_t>(chain.size()));
+            fused.reads = head.reads;
+            fused.writes = head.writes;
+
+            // the fused kernel does all the math but only touches memory once
+            for (size_t k : chain)
+                fused.cost.flops += tasks[k].cost.flops;
+
+            fused.work = make_arena_work(arena, [prog, info = head.fusion](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
+            {
+                SB_LOG_INFO("Fused elementwise kernel: {} ops, {} elements", 
+                            prog.count + (prog.head == MicroOp::NONE ? 0 : 1), info.size);
+                switch (info.dtype)
+                {
+                    case Core::DataType::HALF: return submit_fused<sycl::half>(q, deps, prog, info);
+                    case Core::DataType::FLOAT32: return submit_fused<float>(q, deps, prog, info);
+                    case Core::DataType::FLOAT64: return submit_fused<double>(q, deps, prog, info);
+                    default: return sycl::event();
+                }
+            });
+
+            return fused;
+        }
+    } // namespace Anonymous
+
+    size_t fuse_elementwise(std::vector<TaskRecord>& tasks, TaskArena& arena)
+    {
+        const size_t n = tasks.size();
+        if (n < 2) return 0;
+
+        std::vector<TaskRecord> result;
+        std::vector<bool> consumed(n, false);
+        std::vector<size_t> chain;
+        size_t removed = 0;
+
+        result.reserve(n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (consumed[i]) continue;
+
+            TaskRecord& head = tasks[i];
+            MicroOp head_op = head.fusion.enabled ? to_micro_op(head.meta.op_id) : MicroOp::NONE;
+            bool can_start = head.fusion.lhs != nullptr ? is_binary(head_op) : is_unary(head_op);
+
+            if (!can_start || head.writes.empty())
+            {
+                result.push_back(std::move(head));
+                continue;
+            }
+
+            // Use the range the engine recorded for the head, so it is keyed on the 
+            // allocation like every other task (fusion.out may sit inside a slice or arena view).
+            const AccessRange range = head.writes[0];
+
+            chain.clear();
+            chain.push_back(i);
+
+            // A later step can move up to the head only if nothing in between touches its memory.
+            for (size_t j = i + 1; j < n && j - i <= FUSION_WINDOW && chain.size() < MAX_FUSED_OPS; ++j)
+            {
+                if (consumed[j] || !touches(tasks[j], range)) continue;
+                if (!extends_chain(tasks[j], head.fusion)) break;
+                chain.push_back(j);
+            }
+
+            if (chain.size() == 1)
+            {
+                result.push_back(std::move(head));
+                continue;
+            }
+
+            for (size_t k : chain)
+                consumed[k] = true;
+
+            removed += chain.size() - 1;
+            result.push_back(build_fused_task(tasks, chain, arena));
+        }
+
+        if (removed > 0)
+            SB_LOG_DEBUG("Elementwise fusion: {} tasks -> {} tasks", n, result.size());
+
+        tasks = std::move(result);
+        return removed;
+    }
+
+} // namespace SushiBLAS
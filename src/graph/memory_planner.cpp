@@ -0,0 +1,131 @@
+/**************************************************************************/
+/* memory_planner.cpp                                                     */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <SushiBLAS/graph/task_record.hpp>
+#include <SushiBLAS/graph/memory_planner.hpp>
+
+namespace SushiBLAS 
+{
+    namespace 
+    {
+        size_t align_up(size_t value, size_t alignment)
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+    } // namespace Anonymous
+
+    void compute_lifetimes(std::span<const TaskRecord> tasks, std::span<PlannedBuffer> buffers)
+    {
+        std::unordered_map<const void*, size_t> index;
+        for (size_t i = 0; i < buffers.size(); ++i)
+            if (buffers[i].base) index[buffers[i].base] = i;
+
+        auto touch = [&](std::span<const AccessRange> ranges, uint32_t task) 
+        {
+            for (const AccessRange& r : ranges)
+            {
+                auto it = index.find(r.base);
+                if (it == index.end()) continue;
+
+                PlannedBuffer& b = buffers[it->second];
+                b.first = std::min(b.first, task);
+                b.last = std::max(b.last, task);
+            }
+        };
+
+        for (uint32_t i = 0; i < tasks.size(); ++i)
+        {
+            touch(tasks[i].reads, i);
+            touch(tasks[i].writes, i);
+        }
+    }
+
+    size_t assign_offsets(std::span<PlannedBuffer> buffers, size_t alignment)
+    {
+        std::vector<uint32_t> order;
+        for (uint32_t i = 0; i < buffers.size(); ++i)
+        {
+            buffers[i].planned = false;
+            if (buffers[i].base && buffers[i].first != UINT32_MAX) order.push_back(i);
+        }
+
+        // large buffers first leaves the small ones to fill the gaps
+        std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) 
+        { 
+            return buffers[a].bytes > buffers[b].bytes; 
+        });
+
+        size_t arena = 0;
+        std::vector<uint32_t> live;
+
+        for (uint32_t i : order)
+        {
+            PlannedBuffer& b = buffers[i];
+            size_t need = align_up(b.bytes, alignment);
+
+            // placed buffers that are live at the same time, by offset
+            live.clear();
+            for (uint32_t j : order)
+            {
+                if (j == i) break;
+                const PlannedBuffer& o = buffers[j];
+                if (o.first <= b.last && b.first <= o.last) live.push_back(j);
+            }
+            std::sort(live.begin(), live.end(), [&](uint32_t x, uint32_t y) 
+            { 
+                return buffers[x].offset < buffers[y].offset; 
+            });
+
+            size_t best = SIZE_MAX;
+            size_t best_gap = SIZE_MAX;
+            size_t end = 0;
+            for (uint32_t j : live)
+            {
+                const PlannedBuffer& o = buffers[j];
+                if (o.offset >= end && o.offset - end >= need && o.offset - end < best_gap)
+                {
+                    best = end;
+                    best_gap = o.offset - end;
+                }
+                end = std::max(end, align_up(o.offset + o.bytes, alignment));
+            }
+
+            b.offset = best != SIZE_MAX ? best : end;
+            b.planned = true;
+            arena = std::max(arena, b.offset + need);
+        }
+
+        return arena;
+    }
+
+} // namespace SushiBLAS
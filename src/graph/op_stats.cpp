@@ -0,0 +1,179 @@
+/**************************************************************************/
+/* op_stats.cpp                                                           */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <algorithm>
+#include <SushiBLAS/graph/op_stats.hpp>
+#include <SushiBLAS/graph/profiler.hpp>
+#include <SushiBLAS/graph/task_record.hpp>
+
+namespace SushiBLAS 
+{
+    namespace 
+    {
+        bool is_complete(const sycl::event& e)
+        {
+            return e.get_info<sycl::info::event::command_execution_status>() == sycl::info::event_command_status::complete;
+        }
+
+        /** @brief Nearest-rank percentile of a sorted list. */
+        double percentile(const std::vector<double>& sorted, double p)
+        {
+            if (sorted.empty()) return 0.0;
+            size_t rank = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+            return sorted[std::min(rank, sorted.size() - 1)];
+        }
+    } // namespace Anonymous
+
+    void OpStats::instrument(std::span<TaskRecord> tasks, TaskArena& arena)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        for (TaskRecord& task : tasks)
+        {
+            Sample& sample = in_flight_.emplace_back();
+            sample.op_id = task.meta.op_id.value;
+            sample.name = task.meta.name;
+            sample.flops = task.cost.flops;
+            sample.bytes = task_bytes(task);
+
+            // each task only writes its own sample, the flag publishes it to collect()
+            task.work = make_arena_work(arena, 
+                [work = std::move(task.work), s = &sample]
+                (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
+                {
+                    uint64_t start = Profiler::now_ns();
+                    KernelSpan span;
+                    sycl::event e = work(q, deps);
+
+                    s->host_ns = Profiler::now_ns() - start;
+                    s->first = span.first(e);
+                    s->done = e;
+                    s->submitted.store(true, std::memory_order_release);
+                    return e;
+                });
+        }
+    }
+
+    void OpStats::collect()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        // samples finish roughly in order, so stop at the first one still running
+        while (!in_flight_.empty())
+        {
+            Sample& s = in_flight_.front();
+            if (!s.submitted.load(std::memory_order_acquire) || !is_complete(s.done)) break;
+
+            if (skip_ > 0)
+                --skip_;
+            else
+            {
+                double ms = static_cast<double>(s.host_ns) / 1.0e6;
+                try
+                {
+                    // count every kernel of the task, not only the last one
+                    uint64_t start = s.first.get_profiling_info<sycl::info::event_profiling::command_start>();
+                    uint64_t end = s.done.get_profiling_info<sycl::info::event_profiling::command_end>();
+                    ms = static_cast<double>(end - start) / 1.0e6;
+                }
+                catch (const sycl::exception&)
+                {
+                    // the queue has no profiling enabled, keep the host submit time
+                }
+                add(s, ms);
+            }
+
+            in_flight_.pop_front();
+        }
+    }
+
+    void OpStats::add(const Sample& s, double ms)
+    {
+        Aggregate& agg = ops_[s.op_id];
+        OpStatsEntry& e = agg.entry;
+        if (e.calls == 0)
+        {
+            e.name = s.name ? s.name : "";
+            e.op_id = s.op_id;
+        }
+
+        e.calls++;
+        e.total_ms += ms;
+        e.flops += s.flops;
+        e.bytes += s.bytes;
+
+        agg.recent[agg.recent_count % WINDOW] = ms;
+        agg.recent_count++;
+    }
+
+    std::vector<OpStatsEntry> OpStats::snapshot()
+    {
+        collect();
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        std::vector<OpStatsEntry> result;
+        result.reserve(ops_.size());
+        std::vector<double> sorted;
+
+        for (const auto& [id, agg] : ops_)
+        {
+            OpStatsEntry e = agg.entry;
+
+            size_t n = std::min(agg.recent_count, WINDOW);
+            sorted.assign(agg.recent.begin(), agg.recent.begin() + n);
+            std::sort(sorted.begin(), sorted.end());
+            e.p50_ms = percentile(sorted, 0.50);
+            e.p95_ms = percentile(sorted, 0.95);
+            e.p99_ms = percentile(sorted, 0.99);
+
+            if (e.total_ms > 0.0)
+            {
+                // GFLOP/s = flops / (ms * 1e6), GB/s likewise
+                e.gflops = static_cast<double>(e.flops) / (e.total_ms * 1.0e6);
+                e.gbps = static_cast<double>(e.bytes) / (e.total_ms * 1.0e6);
+            }
+            result.push_back(std::move(e));
+        }
+
+        std::sort(result.begin(), result.end(), [](const OpStatsEntry& a, const OpStatsEntry& b) 
+        { 
+            return a.total_ms > b.total_ms; 
+        });
+        return result;
+    }
+
+    void OpStats::reset()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ops_.clear();
+        skip_ = in_flight_.size();
+    }
+
+} // namespace SushiBLAS
@@ -0,0 +1,125 @@
+/**************************************************************************/
+/* placement.cpp                                                          */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <span>
+#include <array>
+#include <limits>
+#include <algorithm>
+#include <SushiBLAS/graph/priority.hpp>
+#include <SushiBLAS/graph/placement.hpp>
+#include <SushiBLAS/graph/task_record.hpp>
+
+namespace SushiBLAS 
+{
+    namespace 
+    {
+        // a task rarely touches more than a few nodes, nodes past this limit are ignored
+        constexpr size_t MAX_NODES = 8;
+
+        struct NodeBytes 
+        {
+            int node;
+            double bytes;
+        };
+
+        void add_bytes(std::span<const AccessRange> ranges, std::array<NodeBytes, MAX_NODES>& nodes, size_t& count)
+        {
+            for (const AccessRange& r : ranges)
+            {
+                if (r.numa_node < 0 || r.empty()) continue;
+
+                // a whole-allocation range has no known size, it still counts as a vote
+                double bytes = r.end == SIZE_MAX ? 1.0 : static_cast<double>(r.end - r.begin);
+
+                size_t i = 0;
+                while (i < count && nodes[i].node != r.numa_node)
+                    ++i;
+
+                if (i < count)
+                    nodes[i].bytes += bytes;
+                else if (count < MAX_NODES)
+                    nodes[count++] = {r.numa_node, bytes};
+            }
+        }
+    } // namespace Anonymous
+
+    int home_numa_node(const TaskRecord& rec, const SushiRuntime::Topology::NUMAMapper& mapper)
+    {
+        std::array<NodeBytes, MAX_NODES> nodes;
+        size_t count = 0;
+
+        add_bytes(rec.reads, nodes, count);
+        add_bytes(rec.writes, nodes, count);
+
+        if (count == 0) return -1;
+        if (count == 1) return nodes[0].node;
+
+        int best = -1;
+        double best_cost = std::numeric_limits<double>::max();
+        for (size_t c = 0; c < count; ++c)
+        {
+            double cost = 0.0;
+            for (size_t i = 0; i < count; ++i)
+                cost += nodes[i].bytes * mapper.get_distance(nodes[c].node, nodes[i].node);
+
+            if (cost < best_cost)
+            {
+                best_cost = cost;
+                best = nodes[c].node;
+            }
+        }
+
+        return best;
+    }
+
+    void assign_lanes(std::span<const TaskRecord> tasks, 
+                      std::span<const uint32_t> pred_offsets, 
+                      std::span<const uint32_t> preds, 
+                      size_t lane_count, 
+                      std::vector<uint32_t>& lanes)
+    {
+        lanes.assign(tasks.size(), 0);
+        if (lane_count <= 1) return;
+
+        std::vector<double> load(lane_count, 0.0);
+        for (uint32_t i = 0; i < tasks.size(); ++i)
+        {
+            uint32_t lane;
+            if (pred_offsets[i] == pred_offsets[i + 1])
+                lane = static_cast<uint32_t>(std::min_element(load.begin(), load.end()) - load.begin());
+            else
+                lane = lanes[preds[pred_offsets[i]]];
+
+            lanes[i] = lane;
+            load[lane] += estimate_cost(tasks[i]);
+        }
+    }
+
+} // namespace SushiBLAS
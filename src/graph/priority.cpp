@@ -0,0 +1,118 @@
+/**************************************************************************/
+/* priority.cpp                                                           */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <queue>
+#include <algorithm>
+#include <SushiBLAS/graph/priority.hpp>
+#include <SushiBLAS/graph/task_record.hpp>
+
+namespace SushiBLAS 
+{
+    namespace 
+    {
+        // bytes assumed for a range that covers a whole allocation of unknown size
+        constexpr double UNKNOWN_RANGE_BYTES = 4096.0;
+
+        // flops one byte of memory traffic is worth, a typical balance for CPUs and GPUs
+        constexpr double FLOPS_PER_BYTE = 8.0;
+
+        double range_bytes(std::span<const AccessRange> ranges)
+        {
+            double bytes = 0.0;
+            for (const AccessRange& r : ranges)
+                bytes += r.end == SIZE_MAX ? UNKNOWN_RANGE_BYTES : static_cast<double>(r.end - r.begin);
+
+            return bytes;
+        }
+    } // namespace Anonymous
+
+    double estimate_cost(const TaskRecord& rec)
+    {
+        double bytes = rec.cost.bytes > 0 ? static_cast<double>(rec.cost.bytes) 
+                                          : range_bytes(rec.reads) + range_bytes(rec.writes);
+        double flops = static_cast<double>(rec.cost.flops);
+
+        // a task is bound by whichever of its math or its memory traffic takes longer
+        return 1.0 + std::max(bytes, flops / FLOPS_PER_BYTE);
+    }
+
+    void priority_order(std::span<const TaskRecord> tasks, 
+                        std::span<const uint32_t> pred_offsets, 
+                        std::span<const uint32_t> preds, 
+                        std::vector<uint32_t>& order)
+    {
+        const size_t n = tasks.size();
+        order.clear();
+        order.reserve(n);
+
+        // predecessors always have lower ids, so one backward pass gives the upward ranks
+        std::vector<double> rank(n, 0.0);
+        std::vector<uint32_t> waiting(n, 0);
+        for (size_t i = n; i-- > 0;)
+        {
+            rank[i] += estimate_cost(tasks[i]);
+            waiting[i] = pred_offsets[i + 1] - pred_offsets[i];
+
+            for (uint32_t p = pred_offsets[i]; p < pred_offsets[i + 1]; ++p)
+                rank[preds[p]] = std::max(rank[preds[p]], rank[i]);
+        }
+
+        // the predecessor lists point backwards, so build the successor lists once
+        std::vector<uint32_t> succ_offsets(n + 1, 0);
+        for (uint32_t p : preds)
+            ++succ_offsets[p + 1];
+        for (size_t i = 0; i < n; ++i)
+            succ_offsets[i + 1] += succ_offsets[i];
+
+        std::vector<uint32_t> succs(preds.size());
+        std::vector<uint32_t> fill(succ_offsets.begin(), succ_offsets.end() - 1);
+        for (uint32_t i = 0; i < n; ++i)
+            for (uint32_t p = pred_offsets[i]; p < pred_offsets[i + 1]; ++p)
+                succs[fill[preds[p]]++] = i;
+
+        // highest rank first, recording order breaks ties
+        auto lower = [&rank](uint32_t a, uint32_t b) { return rank[a] < rank[b] || (rank[a] == rank[b] && a > b); };
+        std::priority_queue<uint32_t, std::vector<uint32_t>, decltype(lower)> ready(lower);
+
+        for (uint32_t i = 0; i < n; ++i)
+            if (waiting[i] == 0) ready.push(i);
+
+        while (!ready.empty())
+        {
+            uint32_t task = ready.top();
+            ready.pop();
+            order.push_back(task);
+
+            for (uint32_t s = succ_offsets[task]; s < succ_offsets[task + 1]; ++s)
+                if (--waiting[succs[s]] == 0) ready.push(succs[s]);
+        }
+    }
+
+} // namespace SushiBLAS
@@ -0,0 +1,243 @@
+/**************************************************************************/
+/* profiler.cpp                                                           */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <chrono>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+#include <SushiBLAS/core/logger.hpp>
+#include <SushiBLAS/graph/profiler.hpp>
+#include <SushiBLAS/graph/task_record.hpp>
+
+namespace SushiBLAS 
+{
+    namespace 
+    {
+        /** @brief Find the small index of a value, adding it if it is new. */
+        template<typename T>
+        size_t index_of(std::vector<T>& seen, const T& value)
+        {
+            auto it = std::find(seen.begin(), seen.end(), value);
+            if (it != seen.end()) return it - seen.begin();
+
+            seen.push_back(value);
+            return seen.size() - 1;
+        }
+
+        void write_escaped(std::ofstream& ofs, const char* text)
+        {
+            for (const char* c = text ? text : ""; *c; ++c)
+            {
+                if (*c == '"' || *c == '\\') ofs << '\\';
+                ofs << *c;
+            }
+        }
+
+        /** @brief The innermost span open on this thread. */
+        thread_local KernelSpan* current_span = nullptr;
+
+        /** @brief Chrome traces use microseconds. */
+        double to_us(uint64_t ns, uint64_t origin)
+        {
+            return (static_cast<double>(ns) - static_cast<double>(origin)) / 1000.0;
+        }
+    } // namespace Anonymous
+
+    KernelSpan::KernelSpan() : outer_(current_span)
+    {
+        current_span = this;
+    }
+
+    KernelSpan::~KernelSpan()
+    {
+        current_span = outer_;
+    }
+
+    void mark_first_kernel(const sycl::event& e)
+    {
+        for (KernelSpan* span = current_span; span != nullptr; span = span->outer_)
+        {
+            if (span->has_first_) continue;
+            span->first_ = e;
+            span->has_first_ = true;
+        }
+    }
+
+    uint64_t Profiler::now_ns()
+    {
+        auto t = std::chrono::steady_clock::now().time_since_epoch();
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(t).count());
+    }
+
+    void Profiler::instrument(std::span<TaskRecord> tasks, TaskArena& arena)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        uint64_t enqueue = now_ns();
+
+        for (TaskRecord& task : tasks)
+        {
+            TaskTrace& trace = traces_.emplace_back();
+            trace.meta = task.meta;
+            trace.enqueue_ns = enqueue;
+
+            // each task only writes its own entry, the flag publishes it to the readers
+            task.work = make_arena_work(arena, 
+                [work = std::move(task.work), t = &trace]
+                (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
+                {
+                    t->ready_ns = now_ns();
+                    t->thread = std::this_thread::get_id();
+                    t->queue = q;
+
+                    KernelSpan span;
+                    sycl::event e = work(q, deps);
+
+                    t->submitted_ns = now_ns();
+                    t->first = span.first(e);
+                    t->done = e;
+                    t->submitted.store(true, std::memory_order_release);
+                    return e;
+                });
+        }
+    }
+
+    void Profiler::resolve_kernel_times()
+    {
+        for (TaskTrace& t : traces_)
+        {
+            if (t.has_kernel_time || !t.submitted.load(std::memory_order_acquire)) continue;
+
+            try
+            {
+                // the span runs from the first kernel of the task to its last one
+                t.done.wait();
+                uint64_t submit = t.first.get_profiling_info<sycl::info::event_profiling::command_submit>();
+                uint64_t start = t.first.get_profiling_info<sycl::info::event_profiling::command_start>();
+                uint64_t end = t.done.get_profiling_info<sycl::info::event_profiling::command_end>();
+
+                // the device clock is not the host clock, so line up the first device submit with the host call
+                t.kernel_start_ns = t.ready_ns + (start - submit);
+                t.kernel_end_ns = t.ready_ns + (end - submit);
+                t.has_kernel_time = true;
+            }
+            catch (const sycl::exception&)
+            {
+                // the queue has no profiling enabled or the work did not submit anything
+            }
+        }
+    }
+
+    void Profiler::write_chrome_trace(const std::string& path)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        resolve_kernel_times();
+
+        std::ofstream ofs(path);
+        SB_THROW_IF(!ofs.is_open(), "Failed to open trace file for writing: {}", path);
+
+        uint64_t origin = UINT64_MAX;
+        for (const TaskTrace& t : traces_)
+            origin = std::min(origin, t.enqueue_ns);
+
+        std::vector<std::thread::id> threads;
+        std::vector<std::optional<sycl::queue>> queues;
+        bool first = true;
+
+        auto next = [&]() -> std::ofstream& 
+        {
+            ofs << (first ? "\n" : ",\n");
+            first = false;
+            return ofs;
+        };
+
+        ofs << std::fixed;
+        ofs.precision(3);
+        ofs << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        next() << R"({"ph":"M","name":"process_name","pid":0,"args":{"name":"Host"}})";
+        next() << R"({"ph":"M","name":"process_name","pid":1,"args":{"name":"Device"}})";
+        next() << R"({"ph":"M","name":"thread_name","pid":0,"tid":0,"args":{"name":"waiting for dependencies"}})";
+
+        for (size_t i = 0; i < traces_.size(); ++i)
+        {
+            const TaskTrace& t = traces_[i];
+            if (!t.submitted.load(std::memory_order_acquire)) continue;
+
+            size_t tid = index_of(threads, t.thread) + 1;
+            size_t qid = index_of(queues, t.queue);
+
+            // the time between execute() and the work call is scheduler and dependency wait
+            next() << "{\"ph\":\"b\",\"cat\":\"wait\",\"id\":" << i << ",\"pid\":0,\"tid\":0,\"name\":\"";
+            write_escaped(ofs, t.meta.name);
+            ofs << "\",\"ts\":" << to_us(t.enqueue_ns, origin) << "}";
+            next() << "{\"ph\":\"e\",\"cat\":\"wait\",\"id\":" << i << ",\"pid\":0,\"tid\":0,\"name\":\"";
+            write_escaped(ofs, t.meta.name);
+            ofs << "\",\"ts\":" << to_us(t.ready_ns, origin) << "}";
+
+            next() << "{\"ph\":\"X\",\"cat\":\"submit\",\"pid\":0,\"tid\":" << tid << ",\"name\":\"";
+            write_escaped(ofs, t.meta.name);
+            ofs << "\",\"ts\":" << to_us(t.ready_ns, origin) 
+                << ",\"dur\":" << to_us(t.submitted_ns, t.ready_ns) 
+                << ",\"args\":{\"op_id\":" << t.meta.op_id.value 
+                << ",\"wait_us\":" << to_us(t.ready_ns, t.enqueue_ns) << "}}";
+
+            if (t.has_kernel_time)
+            {
+                next() << "{\"ph\":\"X\",\"cat\":\"kernel\",\"pid\":1,\"tid\":" << qid << ",\"name\":\"";
+                write_escaped(ofs, t.meta.name);
+                ofs << "\",\"ts\":" << to_us(t.kernel_start_ns, origin) 
+                    << ",\"dur\":" << to_us(t.kernel_end_ns, t.kernel_start_ns) 
+                    << ",\"args\":{\"op_id\":" << t.meta.op_id.value << "}}";
+            }
+        }
+
+        for (size_t i = 0; i < threads.size(); ++i)
+            next() << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":0,\"tid\":" << i + 1 
+                   << ",\"args\":{\"name\":\"worker " << i << "\"}}";
+        for (size_t i = 0; i < queues.size(); ++i)
+            next() << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" << i 
+                   << ",\"args\":{\"name\":\"queue " << i << "\"}}";
+
+        ofs << "\n]}\n";
+        SB_LOG_INFO("Wrote Chrome trace with {} tasks: {}", traces_.size(), path);
+    }
+
+    void Profiler::clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        traces_.clear();
+    }
+
+    size_t Profiler::size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return traces_.size();
+    }
+
+} // namespace SushiBLAS
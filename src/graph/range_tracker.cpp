@@ -0,0 +1,165 @@
+/**************************************************************************/
+/* range_tracker.cpp                                                      */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <algorithm>
+#include <SushiBLAS/graph/task_record.hpp>
+#include <SushiBLAS/graph/range_tracker.hpp>
+
+namespace SushiBLAS 
+{
+    void RangeTracker::record(uint32_t task, 
+                              std::span<const AccessRange> reads, 
+                              std::span<const AccessRange> writes, 
+                              std::vector<uint32_t>& preds)
+    {
+        collect(reads, writes, preds);
+        insert(task, reads, writes);
+    }
+
+    template<typename Fn>
+    void RangeTracker::for_overlapping(const Allocation& alloc, size_t begin, size_t end, Fn&& fn)
+    {
+        // an access that starts at or before begin - max_bytes ends at or before begin
+        size_t first = begin > alloc.max_bytes ? begin - alloc.max_bytes : 0;
+        auto it = std::upper_bound(alloc.accesses.begin(), alloc.accesses.end(), first, 
+                                   [](size_t value, const Access& a) { return value < a.begin; });
+        if (first == 0) it = alloc.accesses.begin();
+
+        for (; it != alloc.accesses.end() && it->begin < end; ++it)
+            if (begin < it->end) fn(*it);
+    }
+
+    void RangeTracker::collect(std::span<const AccessRange> reads, 
+                               std::span<const AccessRange> writes, 
+                               std::vector<uint32_t>& preds) const
+    {
+        // read-after-write
+        for (const AccessRange& r : reads)
+        {
+            if (r.empty()) continue;
+            auto it = allocations_.find(r.base);
+            if (it == allocations_.end()) continue;
+
+            for_overlapping(it->second, r.begin, r.end, [&](const Access& a) 
+            { 
+                if (a.is_write) preds.push_back(a.task); 
+            });
+        }
+
+        // write-after-write and write-after-read
+        for (const AccessRange& w : writes)
+        {
+            if (w.empty()) continue;
+            auto it = allocations_.find(w.base);
+            if (it == allocations_.end()) continue;
+
+            for_overlapping(it->second, w.begin, w.end, [&](const Access& a) { preds.push_back(a.task); });
+        }
+    }
+
+    void RangeTracker::insert(uint32_t task, 
+                              std::span<const AccessRange> reads, 
+                              std::span<const AccessRange> writes)
+    {
+        auto add = [](Allocation& alloc, const Access& access)
+        {
+            // tasks mostly walk a buffer forward, so this is usually an append
+            auto pos = std::upper_bound(alloc.accesses.begin(), alloc.accesses.end(), access.begin, 
+                                        [](size_t value, const Access& a) { return value < a.begin; });
+            alloc.accesses.insert(pos, access);
+            alloc.max_bytes = std::max(alloc.max_bytes, access.end - access.begin);
+        };
+
+        for (const AccessRange& r : reads)
+            if (!r.empty()) 
+                add(allocations_[r.base], {r.begin, r.end, task, false});
+
+        for (const AccessRange& w : writes)
+        {
+            if (w.empty()) continue;
+
+            // anything fully inside this write is now ordered before it
+            Allocation& alloc = allocations_[w.base];
+            auto first = std::lower_bound(alloc.accesses.begin(), alloc.accesses.end(), w.begin, 
+                                          [](const Access& a, size_t value) { return a.begin < value; });
+            auto last = std::lower_bound(first, alloc.accesses.end(), w.end, 
+                                         [](const Access& a, size_t value) { return a.begin < value; });
+            alloc.accesses.erase(std::remove_if(first, last, [&](const Access& a) { return a.end <= w.end; }), last);
+
+            add(alloc, {w.begin, w.end, task, true});
+        }
+    }
+
+    void RangeTracker::erase_before(uint32_t task)
+    {
+        for (auto it = allocations_.begin(); it != allocations_.end();)
+        {
+            Allocation& alloc = it->second;
+            std::erase_if(alloc.accesses, [task](const Access& a) { return a.task < task; });
+
+            if (alloc.accesses.empty()) 
+            {
+                it = allocations_.erase(it);
+                continue;
+            }
+
+            alloc.max_bytes = 0;
+            for (const Access& a : alloc.accesses)
+                alloc.max_bytes = std::max(alloc.max_bytes, a.end - a.begin);
+            ++it;
+        }
+    }
+
+    void RangeTracker::clear()
+    {
+        allocations_.clear();
+    }
+
+    void build_task_edges(std::span<const TaskRecord> tasks, 
+                          RangeTracker& tracker, 
+                          std::vector<uint32_t>& pred_offsets, 
+                          std::vector<uint32_t>& preds)
+    {
+        tracker.clear();
+        pred_offsets.assign(1, 0);
+        preds.clear();
+
+        for (uint32_t i = 0; i < tasks.size(); ++i)
+        {
+            size_t first = preds.size();
+            tracker.record(i, tasks[i].reads, tasks[i].writes, preds);
+
+            std::sort(preds.begin() + first, preds.end());
+            preds.erase(std::unique(preds.begin() + first, preds.end()), preds.end());
+            pred_offsets.push_back(static_cast<uint32_t>(preds.size()));
+        }
+    }
+
+} // namespace SushiBLAS
@@ -0,0 +1,95 @@
+/**************************************************************************/
+/* task_arena.cpp                                                         */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <SushiBLAS/graph/task_arena.hpp>
+
+namespace SushiBLAS 
+{
+    TaskArena::~TaskArena()
+    {
+        run_destructors();
+    }
+
+    void* TaskArena::allocate(size_t bytes, size_t align)
+    {
+        // try the current block, then any block kept from an earlier epoch
+        while (current_ < blocks_.size())
+        {
+            Block& block = blocks_[current_];
+            uintptr_t base = reinterpret_cast<uintptr_t>(block.data.get());
+            uintptr_t aligned = (base + offset_ + align - 1) & ~(uintptr_t)(align - 1);
+            size_t end = (aligned - base) + bytes;
+
+            if (end <= block.size)
+            {
+                offset_ = end;
+                used_ += bytes;
+                return reinterpret_cast<void*>(aligned);
+            }
+
+            ++current_;
+            offset_ = 0;
+        }
+
+        size_t size = bytes + align > BLOCK_SIZE ? bytes + align : BLOCK_SIZE;
+        blocks_.push_back({std::make_unique<std::byte[]>(size), size});
+        current_ = blocks_.size() - 1;
+        offset_ = 0;
+        return allocate(bytes, align);
+    }
+
+    void TaskArena::reset()
+    {
+        run_destructors();
+        current_ = 0;
+        offset_ = 0;
+        used_ = 0;
+    }
+
+    size_t TaskArena::bytes_reserved() const
+    {
+        size_t total = 0;
+        for (const Block& block : blocks_)
+            total += block.size;
+        return total;
+    }
+
+    void TaskArena::run_destructors()
+    {
+        // objects are destroyed in reverse order of creation
+        while (dtors_)
+        {
+            DtorEntry* entry = dtors_;
+            dtors_ = entry->next;
+            entry->destroy(entry->object);
+        }
+    }
+
+} // namespace SushiBLAS
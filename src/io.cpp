@@ -28,214 +28,453 @@
 /* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
 /**************************************************************************/
 
+#include <memory>
 #include <vector>
+#include <future>
+#include <cstddef>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <sstream>
 #include <iostream>
 #include <SushiBLAS/io.hpp>
 #include <SushiBLAS/engine.hpp>
+#include <SushiBLAS/io/file.hpp>
+#include <SushiBLAS/io/parallel_io.hpp>
+#include <SushiBLAS/io/mapped_storage.hpp>
+#include <SushiRuntime/graph/task_types.hpp>
 
 namespace SushiBLAS
 {
-    /** @brief Internal header for .sushi files */
+    using namespace SushiRuntime::Graph::Literals;
+
+    /** 
+     * @brief Internal header for .sushi files 
+     * 
+     * Version 1 files end the header at data_offset and the data follows it.
+     * Version 2 adds data_offset, which is page aligned so the data can be mapped.
+     */
     struct SushiHeader 
     {
         char magic[6] = "SUSHI";
-        uint32_t version = 1;
+        uint32_t version = 2;
         int32_t rank;
         int64_t shape[Core::MAX_TENSOR_RANK];
         int32_t dtype;
         int32_t layout;
+        uint64_t data_offset = 0;
     };
 
-    void IO::save(const Tensor& t, const std::string& path)
+    namespace
     {
-        SushiHeader header;
-        header.rank = t.rank;
-        header.dtype = static_cast<int32_t>(t.dtype);
-        header.layout = static_cast<int32_t>(t.layout);
+        /** @brief The alignment of the data in version 2 files. It matches the usual page size. */
+        constexpr size_t SUSHI_DATA_ALIGNMENT = 4096;
 
-        for (int i = 0; i < t.rank; ++i)
-            header.shape[i] = t.shape[i];
+        /** @brief Read and check a .sushi header of any version. data_offset is always set. */
+        SushiHeader read_header(std::istream& is, const std::string& path)
+        {
+            SushiHeader header;
+            constexpr size_t v1_bytes = offsetof(SushiHeader, data_offset);
+            is.read(reinterpret_cast<char*>(&header), v1_bytes);
+
+            SB_THROW_IF(!is || std::string(header.magic, 5) != "SUSHI", "Invalid .sushi file magic: {}", path);
+            SB_THROW_IF(header.version < 1 || header.version > 2, "Unsupported .sushi version {} in {}", header.version, path);
+            SB_THROW_IF(header.rank < 0 || header.rank > static_cast<int32_t>(Core::MAX_TENSOR_RANK), 
+                        "Invalid rank {} in {}", header.rank, path);
+            SB_THROW_IF(header.dtype < 0 || header.dtype > static_cast<int32_t>(Core::DataType::COMPLEX64), 
+                        "Unknown dtype {} in {}", header.dtype, path);
+            SB_THROW_IF(header.layout < 0 || header.layout > static_cast<int32_t>(Core::Layout::COLUMN_MAJOR), 
+                        "Unknown layout {} in {}", header.layout, path);
+
+            if (header.version == 1)
+                header.data_offset = v1_bytes;
+            else
+                is.read(reinterpret_cast<char*>(&header.data_offset), sizeof(header.data_offset));
+
+            SB_THROW_IF(!is, "Truncated .sushi header: {}", path);
+            return header;
+        }
 
-        engine_.execute().wait();
-        
-        std::ofstream ofs(path, std::ios::binary);
-        SB_THROW_IF(!ofs.is_open(), "Failed to open file for writing: {}", path);
+        /** @brief Get the bytes of the data of a contiguous tensor. */
+        size_t data_bytes(const Tensor& t)
+        {
+            return static_cast<size_t>(t.num_elements) * Core::element_size(t.dtype);
+        }
 
-        ofs.write(reinterpret_cast<const char*>(&header), sizeof(SushiHeader));
-        
-        size_t bpe = (t.dtype == Core::DataType::FLOAT64 || t.dtype == Core::DataType::COMPLEX32) ? 8 : 
-                     (t.dtype == Core::DataType::COMPLEX64) ? 16 : 4;
-        size_t bytes = t.num_elements * bpe;
-        
-        if (t.storage->strategy == SushiRuntime::Memory::AllocStrategy::DEVICE)
+        /** @brief Write the header of a file format. The data follows it directly. */
+        void write_header(std::ostream& os, const Tensor& t, FileFormat format)
         {
-            std::vector<char> buf(bytes);
-            engine_.get_context().get_queue().memcpy(buf.data(), t.data(), bytes).wait();
-            ofs.write(buf.data(), bytes);
+            if (format == FileFormat::SUSHI)
+            {
+                SushiHeader header;
+                header.rank = t.rank;
+                header.dtype = static_cast<int32_t>(t.dtype);
+                header.layout = static_cast<int32_t>(t.layout);
+                header.data_offset = (sizeof(SushiHeader) + SUSHI_DATA_ALIGNMENT - 1) / SUSHI_DATA_ALIGNMENT * SUSHI_DATA_ALIGNMENT;
+
+                for (int i = 0; i < t.rank; ++i)
+                    header.shape[i] = t.shape[i];
+
+                os.write(reinterpret_cast<const char*>(&header), sizeof(SushiHeader));
+
+                std::vector<char> padding(header.data_offset - sizeof(SushiHeader), 0);
+                os.write(padding.data(), padding.size());
+            }
+            else if (format == FileFormat::NPY)
+            {
+                const char magic[] = "\x93NUMPY";
+                uint8_t major = 1;
+                uint8_t minor = 0;
+                
+                std::string dict = "{'descr': '";
+
+                if (t.dtype == Core::DataType::FLOAT32) dict += "<f4";
+                else if (t.dtype == Core::DataType::FLOAT64) dict += "<f8";
+                else if (t.dtype == Core::DataType::COMPLEX32) dict += "<c8";
+                else if (t.dtype == Core::DataType::COMPLEX64) dict += "<c16";
+                
+                dict += "', 'fortran_order': ";
+                dict += (t.layout == Core::Layout::COLUMN_MAJOR) ? "True" : "False";
+                dict += ", 'shape': (";
+
+                for (int i = 0; i < t.rank; ++i) 
+                {
+                    dict += std::to_string(t.shape[i]);
+
+                    if (t.rank == 1 || i < t.rank - 1) dict += ",";
+                    if (i < t.rank - 1) dict += " ";
+                }
+                dict += "), }";
+
+                while ((10 + dict.length() + 1) % 64 != 0) dict += " ";
+
+                dict += "\n";
+
+                uint16_t header_len = static_cast<uint16_t>(dict.length());
+
+                os.write(magic, 6);
+                os.write(reinterpret_cast<const char*>(&major), 1);
+                os.write(reinterpret_cast<const char*>(&minor), 1);
+                os.write(reinterpret_cast<const char*>(&header_len), 2);
+                os.write(dict.c_str(), header_len);
+            }
         }
-        else
-            ofs.write(static_cast<const char*>(t.data()), bytes);
 
-        SB_LOG_INFO("Saved native SushiBLAS file: {}", path);
-    }
+        /** @brief Read and check the header of a file format, leaving the stream at the data. */
+        void read_header(std::istream& is, const Tensor& t, FileFormat format, const std::string& path)
+        {
+            if (format == FileFormat::SUSHI)
+            {
+                SushiHeader header = read_header(is, path);
+                SB_THROW_IF(header.rank != t.rank, "Rank mismatch in .sushi file.");
 
-    void IO::load(Tensor& t, const std::string& path)
-    {
-        std::ifstream ifs(path, std::ios::binary);
-        SB_THROW_IF(!ifs.is_open(), "Failed to open file for reading: {}", path);
+                for (int i = 0; i < t.rank; ++i)
+                    SB_THROW_IF(header.shape[i] != t.shape[i], "Dimension mismatch at index {}", i);
 
-        SushiHeader header;
-        ifs.read(reinterpret_cast<char*>(&header), sizeof(SushiHeader));
+                is.seekg(static_cast<std::streamoff>(header.data_offset));
+            }
+            else if (format == FileFormat::NPY)
+            {
+                char magic[6];
+                is.read(magic, 6);
+                SB_THROW_IF(std::string(magic, 6) != "\x93NUMPY", "Invalid .npy file magic.");
+
+                uint8_t major, minor;
+                is.read(reinterpret_cast<char*>(&major), 1);
+                is.read(reinterpret_cast<char*>(&minor), 1);
+
+                uint16_t header_len;
+                is.read(reinterpret_cast<char*>(&header_len), 2);
+
+                std::string header(header_len, ' ');
+                is.read(&header[0], header_len);
+
+                // TODO: Implement comprehensive .npy header parsing for metadata verification (dtype, fortran_order).
+                // TODO: Enhance shape verification logic to ensure exact matching.
+                size_t shape_pos = header.find("'shape': (");
+                if (shape_pos != std::string::npos)
+                    for (int i = 0; i < t.rank; ++i)
+                        if (header.find(std::to_string(t.shape[i]), shape_pos) == std::string::npos)
+                            SB_THROW_IF(true, "Shape dimension {} mismatch in .npy header.", i);
+            }
+        }
 
-        SB_THROW_IF(std::string(header.magic, 5) != "SUSHI", "Invalid .sushi file magic.");
-        SB_THROW_IF(header.rank != t.rank, "Rank mismatch in .sushi file.");
+        /** 
+         * @brief Write a header and a tensor's data to a file. 
+         * 
+         * The data is written in chunks by the engine's ParallelIO. Pass the queue 
+         * if the data is DEVICE memory, so the chunks are copied through staging buffers.
+         */
+        void write_file(ParallelIO& pio, const std::string& path, const Tensor& t, const void* data, 
+                        FileFormat format, sycl::queue* device_queue = nullptr)
+        {
+            std::ostringstream header;
+            write_header(header, t, format);
+            std::string bytes = header.str();
 
-        for (int i = 0; i < t.rank; ++i)
-            SB_THROW_IF(header.shape[i] != t.shape[i], "Dimension mismatch at index {}", i);
+            File file(path, File::Mode::WRITE);
+            file.write_at(bytes.data(), bytes.size(), 0);
+            pio.write(file, bytes.size(), data, data_bytes(t), device_queue);
+        }
 
-        size_t bpe = (t.dtype == Core::DataType::FLOAT64 || t.dtype == Core::DataType::COMPLEX32) ? 8 : 
-                     (t.dtype == Core::DataType::COMPLEX64) ? 16 : 4;
-        size_t bytes = t.num_elements * bpe;
-        
-        if (t.storage->strategy == SushiRuntime::Memory::AllocStrategy::DEVICE)
+        /** @brief Read the data of a file into memory, after checking its header against a tensor. */
+        void read_file(ParallelIO& pio, const std::string& path, const Tensor& t, void* data, 
+                       FileFormat format, sycl::queue* device_queue = nullptr)
         {
-            std::vector<char> buf(bytes);
-            ifs.read(buf.data(), bytes);
-            engine_.get_context().get_queue().memcpy(t.data(), buf.data(), bytes).wait();
+            uint64_t offset = 0;
+            {
+                std::ifstream ifs(path, std::ios::binary);
+                SB_THROW_IF(!ifs.is_open(), "Failed to open file for reading: {}", path);
+                read_header(ifs, t, format, path);
+                offset = static_cast<uint64_t>(ifs.tellg());
+            }
+
+            File file(path, File::Mode::READ);
+            SB_THROW_IF(offset + data_bytes(t) > file.size(), "File is shorter than the tensor: {}", path);
+            pio.read(file, offset, data, data_bytes(t), device_queue);
         }
-        else
-            ifs.read(static_cast<char*>(t.data()), bytes);
-    }
 
-    void IO::save_bin(const Tensor& t, const std::string& path)
+        /** @brief The state shared by an async IO task, its file job and the caller's future. */
+        struct AsyncIO 
+        {
+            Tensor target;
+            Tensor staging;
+            std::string path;
+            FileFormat format;
+            std::promise<void> done;
+            std::shared_future<void> read;
+        };
+    } // namespace Anonymous
+
+    void IO::save_to(const Tensor& t, const std::string& path, FileFormat format)
     {
         engine_.execute().wait();
-        std::ofstream ofs(path, std::ios::binary);
-        SB_THROW_IF(!ofs.is_open(), "Failed to open file: {}", path);
 
-        size_t bpe = (t.dtype == Core::DataType::FLOAT64 || t.dtype == Core::DataType::COMPLEX32) ? 8 : 
-                     (t.dtype == Core::DataType::COMPLEX64) ? 16 : 4;
-        size_t bytes = t.num_elements * bpe;
-        ofs.write(static_cast<const char*>(t.data()), bytes);
+        sycl::queue* device_queue = nullptr;
+        if (t.storage->strategy == SushiRuntime::Memory::AllocStrategy::DEVICE)
+            device_queue = &engine_.get_context().get_queue();
+
+        write_file(engine_.parallel_io(), path, t, t.data(), format, device_queue);
     }
 
-    void IO::load_bin(Tensor& t, const std::string& path)
+    void IO::load_from(Tensor& t, const std::string& path, FileFormat format)
     {
-        std::ifstream ifs(path, std::ios::binary);
-        SB_THROW_IF(!ifs.is_open(), "Failed to open file: {}", path);
+        sycl::queue* device_queue = nullptr;
+        if (t.storage->strategy == SushiRuntime::Memory::AllocStrategy::DEVICE)
+            device_queue = &engine_.get_context().get_queue();
 
-        size_t bpe = (t.dtype == Core::DataType::FLOAT64 || t.dtype == Core::DataType::COMPLEX32) ? 8 : 
-                     (t.dtype == Core::DataType::COMPLEX64) ? 16 : 4;
-        size_t bytes = t.num_elements * bpe;
-        ifs.read(static_cast<char*>(t.data()), bytes);
+        read_file(engine_.parallel_io(), path, t, t.data(), format, device_queue);
     }
 
-    void IO::save_npy(const Tensor& t, const std::string& path)
+    void IO::save(const Tensor& t, const std::string& path)
     {
-        engine_.execute().wait();
-        
-        std::ofstream ofs(path, std::ios::binary);
-        SB_THROW_IF(!ofs.is_open(), "Failed to open file: {}", path);
+        save_to(t, path, FileFormat::SUSHI);
+        SB_LOG_INFO("Saved native SushiBLAS file: {}", path);
+    }
 
-        // 1. Prepare NumPy Header
-        const char magic[] = "\x93NUMPY";
-        uint8_t major = 1;
-        uint8_t minor = 0;
-        
-        std::string dict = "{'descr': '";
+    void IO::load(Tensor& t, const std::string& path)
+    {
+        load_from(t, path, FileFormat::SUSHI);
+    }
 
-        if (t.dtype == Core::DataType::FLOAT32) dict += "<f4";
-        else if (t.dtype == Core::DataType::FLOAT64) dict += "<f8";
-        else if (t.dtype == Core::DataType::COMPLEX32) dict += "<c8";
-        else if (t.dtype == Core::DataType::COMPLEX64) dict += "<c16";
-        
-        dict += "', 'fortran_order': ";
-        dict += (t.layout == Core::Layout::COLUMN_MAJOR) ? "True" : "False";
-        dict += ", 'shape': (";
+    std::future<void> IO::save_async(const Tensor& t, const std::string& path, FileFormat format)
+    {
+        SB_THROW_IF(engine_.is_capturing(), "Async IO cannot be captured into a graph");
+
+        auto state = std::make_shared<AsyncIO>();
+        state->target = t;
+        state->staging = engine_.create_tensor({t.num_elements}, t.dtype, SushiRuntime::Memory::AllocStrategy::HOST);
+        state->path = path;
+        state->format = format;
+        std::future<void> future = state->done.get_future();
+
+        SushiRuntime::Graph::TaskMetadata meta;
+        meta.name = "io.save";
+        meta.task_type = SushiRuntime::Graph::TaskType::MEMORY_COPY;
+        meta.op_id = "io.save"_op;
+
+        size_t bytes = data_bytes(t);
+        std::vector<AccessRange> reads = {t.access_range()};
+        std::vector<AccessRange> writes = {state->staging.access_range()};
+
+        IOWorker& worker = engine_.io_worker();
+        ParallelIO& pio = engine_.parallel_io();
+        engine_.add_task(meta, reads, writes,
+            [state, &worker, &pio, bytes](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event
+            {
+                // Later writers of the tensor only wait for this snapshot, not for the file.
+                sycl::event copied = q.memcpy(state->staging.data(), state->target.data(), bytes, deps);
 
-        for (int i = 0; i < t.rank; ++i) 
-        {
-            dict += std::to_string(t.shape[i]);
+                worker.submit([state, copied, &pio]() mutable
+                {
+                    try
+                    {
+                        copied.wait();
+                        write_file(pio, state->path, state->target, state->staging.data(), state->format);
+                        state->done.set_value();
+                        SB_LOG_INFO("Saved {} in the background", state->path);
+                    }
+                    catch (...)
+                    {
+                        state->done.set_exception(std::current_exception());
+                    }
+
+                    state->staging = Tensor();
+                    state->target = Tensor();
+                });
+                return copied;
+            }, {}, OpCost{0, 2 * bytes});
+
+        return future;
+    }
 
-            if (t.rank == 1 || i < t.rank - 1) dict += ",";
-            if (i < t.rank - 1) dict += " ";
-        }
-        dict += "), }";
+    std::future<void> IO::load_async(Tensor& t, const std::string& path, FileFormat format)
+    {
+        SB_THROW_IF(engine_.is_capturing(), "Async IO cannot be captured into a graph");
+
+        auto state = std::make_shared<AsyncIO>();
+        state->target = t;
+        state->staging = engine_.create_tensor({t.num_elements}, t.dtype, SushiRuntime::Memory::AllocStrategy::HOST);
+        state->path = path;
+        state->format = format;
+        std::future<void> future = state->done.get_future();
+
+        // The file is read now, while earlier tasks that use the tensor still run.
+        auto read = std::make_shared<std::promise<void>>();
+        state->read = read->get_future().share();
+        ParallelIO& pio = engine_.parallel_io();
+        engine_.io_worker().submit([state, read, &pio]()
+        {
+            try
+            {
+                read_file(pio, state->path, state->target, state->staging.data(), state->format);
+                read->set_value();
+            }
+            catch (...)
+            {
+                read->set_exception(std::current_exception());
+            }
+        });
 
-        while ((10 + dict.length() + 1) % 64 != 0) dict += " ";
+        SushiRuntime::Graph::TaskMetadata meta;
+        meta.name = "io.load";
+        meta.task_type = SushiRuntime::Graph::TaskType::MEMORY_COPY;
+        meta.op_id = "io.load"_op;
 
-        dict += "\n";
+        size_t bytes = data_bytes(t);
+        std::vector<AccessRange> reads = {state->staging.access_range()};
+        std::vector<AccessRange> writes = {t.access_range()};
 
-        uint16_t header_len = static_cast<uint16_t>(dict.length());
+        engine_.add_task(meta, reads, writes,
+            [state, bytes](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event
+            {
+                // The copy runs in the host task, after the read succeeded. A failed read 
+                // leaves the tensor as it was instead of filling it with staging memory.
+                return q.submit([&](sycl::handler& h)
+                {
+                    h.depends_on(deps);
+                    h.host_task([state, bytes, q]() mutable
+                    {
+                        try
+                        {
+                            state->read.get();
+                            if (state->target.storage->strategy == SushiRuntime::Memory::AllocStrategy::DEVICE)
+                                q.memcpy(state->target.data(), state->staging.data(), bytes).wait();
+                            else
+                                std::memcpy(state->target.data(), state->staging.data(), bytes);
+                            state->done.set_value();
+                        }
+                        catch (...)
+                        {
+                            state->done.set_exception(std::current_exception());
+                        }
+
+                        state->staging = Tensor();
+                        state->target = Tensor();
+                    });
+                });
+            }, {}, OpCost{0, 2 * bytes});
+
+        return future;
+    }
 
-        ofs.write(magic, 6);
-        ofs.write(reinterpret_cast<const char*>(&major), 1);
-        ofs.write(reinterpret_cast<const char*>(&minor), 1);
-        ofs.write(reinterpret_cast<const char*>(&header_len), 2);
-        ofs.write(dict.c_str(), header_len);
+    Tensor IO::map(const std::string& path, MapMode mode)
+    {
+        SushiHeader header;
+        {
+            std::ifstream ifs(path, std::ios::binary);
+            SB_THROW_IF(!ifs.is_open(), "Failed to open file for reading: {}", path);
+            header = read_header(ifs, path);
+        }
 
-        // 2. Write Data
-        size_t bpe = (t.dtype == Core::DataType::FLOAT64 || t.dtype == Core::DataType::COMPLEX32) ? 8 : 
-                     (t.dtype == Core::DataType::COMPLEX64) ? 16 : 4;
-        
-        size_t bytes = t.num_elements * bpe;
+        auto mapping = SushiRuntime::make_sushi<MappedStorage>(path, mode);
+        uint64_t file_bytes = mapping->size_bytes;
+        SB_THROW_IF(header.data_offset > file_bytes, "Data offset of {} lies past the end of the file", path);
 
-        if (t.storage->strategy == SushiRuntime::Memory::AllocStrategy::DEVICE)
+        // The data must fit in the file, so a larger element count is already wrong and the math can not wrap.
+        auto dtype = static_cast<Core::DataType>(header.dtype);
+        uint64_t elements = 1;
+        for (int i = 0; i < header.rank; ++i)
         {
-            std::vector<char> buf(bytes);
-            engine_.get_context().get_queue().memcpy(buf.data(), t.data(), bytes).wait();
-            ofs.write(buf.data(), bytes);
+            SB_THROW_IF(header.shape[i] < 0, "Negative dimension {} in {}", header.shape[i], path);
+            uint64_t dim = static_cast<uint64_t>(header.shape[i]);
+            SB_THROW_IF(dim != 0 && elements > file_bytes / dim, "Shape in {} does not fit in the file", path);
+            elements *= dim;
         }
-        else
-            ofs.write(static_cast<const char*>(t.data()), bytes);
-        
-        SB_LOG_INFO("Exported NumPy file: {}", path);
+
+        SB_THROW_IF(elements > (file_bytes - header.data_offset) / Core::element_size(dtype), 
+                    "File {} holds {} bytes, but its header needs {} elements after byte {}", path, file_bytes, elements, header.data_offset);
+        uint64_t bytes = elements * Core::element_size(dtype);
+
+        if (header.data_offset % MappedStorage::page_size() != 0)
+            SB_LOG_WARN("{} is a version {} file, its data is not page aligned", path, header.version);
+
+        // The view starts at the data, so the tensor has no storage offset.
+        auto view = SushiRuntime::make_sushi<Storage>(SushiRuntime::sushi_ptr<Storage>(mapping), header.data_offset, bytes);
+        return Tensor(view, std::span<const int64_t>(header.shape, header.rank), 0, static_cast<Core::Layout>(header.layout), dtype);
     }
 
-    void IO::load_npy(Tensor& t, const std::string& path)
+    void IO::save_archive(const std::vector<std::pair<std::string, Tensor>>& tensors, const std::string& path)
     {
-        std::ifstream ifs(path, std::ios::binary);
-        SB_THROW_IF(!ifs.is_open(), "Failed to open file for reading: {}", path);
-
-        char magic[6];
-        ifs.read(magic, 6);
-        SB_THROW_IF(std::string(magic, 6) != "\x93NUMPY", "Invalid .npy file magic.");
+        write_archive(engine_, tensors, path);
+    }
 
-        uint8_t major, minor;
-        ifs.read(reinterpret_cast<char*>(&major), 1);
-        ifs.read(reinterpret_cast<char*>(&minor), 1);
+    Archive IO::open_archive(const std::string& path)
+    {
+        return Archive(engine_, path);
+    }
 
-        uint16_t header_len;
-        ifs.read(reinterpret_cast<char*>(&header_len), 2);
+    void IO::save_safetensors(const std::vector<std::pair<std::string, Tensor>>& tensors, const std::string& path,
+                              const std::map<std::string, std::string>& metadata)
+    {
+        write_safetensors(engine_, tensors, path, metadata);
+    }
 
-        std::string header(header_len, ' ');
-        ifs.read(&header[0], header_len);
+    SafeTensors IO::open_safetensors(const std::string& path, MapMode mode)
+    {
+        return SafeTensors(engine_, path, mode);
+    }
 
-        // TODO: Implement comprehensive .npy header parsing for metadata verification (dtype, fortran_order).
-        // TODO: Enhance shape verification logic to ensure exact matching.
-        size_t shape_pos = header.find("'shape': (");
-        if (shape_pos != std::string::npos)
-            for (int i = 0; i < t.rank; ++i)
-                if (header.find(std::to_string(t.shape[i]), shape_pos) == std::string::npos)
-                    SB_THROW_IF(true, "Shape dimension {} mismatch in .npy header.", i);
+    void IO::save_bin(const Tensor& t, const std::string& path)
+    {
+        save_to(t, path, FileFormat::BIN);
+    }
 
-        // TODO: Optimize data loading path for different allocation strategies and layout orders.
-        size_t bpe = (t.dtype == Core::DataType::FLOAT64 || t.dtype == Core::DataType::COMPLEX32) ? 8 : 
-                     (t.dtype == Core::DataType::COMPLEX64) ? 16 : 4;
-        size_t bytes = t.num_elements * bpe;
+    void IO::load_bin(Tensor& t, const std::string& path)
+    {
+        load_from(t, path, FileFormat::BIN);
+    }
 
-        if (t.storage->strategy == SushiRuntime::Memory::AllocStrategy::DEVICE)
-        {
-            std::vector<char> buf(bytes);
-            ifs.read(buf.data(), bytes);
-            engine_.get_context().get_queue().memcpy(t.data(), buf.data(), bytes).wait();
-        }
-        else
-            ifs.read(static_cast<char*>(t.data()), bytes);
+    void IO::save_npy(const Tensor& t, const std::string& path)
+    {
+        save_to(t, path, FileFormat::NPY);
+        SB_LOG_INFO("Exported NumPy file: {}", path);
+    }
 
+    void IO::load_npy(Tensor& t, const std::string& path)
+    {
+        // TODO: Optimize data loading path for different allocation strategies and layout orders.
+        load_from(t, path, FileFormat::NPY);
         SB_LOG_INFO("Loaded NumPy file: {}", path);
     }
 
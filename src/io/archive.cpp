@@ -0,0 +1,343 @@
+/**************************************************************************/
+/* archive.cpp                                                            */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <span>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <cstring>
+#include <algorithm>
+#include <exception>
+#include <unordered_set>
+#include <SushiBLAS/engine.hpp>
+#include <SushiBLAS/io/archive.hpp>
+
+namespace SushiBLAS 
+{
+    namespace 
+    {
+        /** @brief The fixed start of an archive. The index follows it. */
+        struct ArchiveHeader 
+        {
+            char magic[8] = "SUSHIAR";
+            uint32_t version = 1;
+            uint32_t count = 0;
+            uint64_t index_bytes = 0;
+        };
+
+        /** @brief The fixed part of one index record. The name follows it. */
+        struct IndexRecord 
+        {
+            int32_t dtype;
+            int32_t layout;
+            int32_t rank;
+            uint32_t name_bytes;
+            int64_t shape[Core::MAX_TENSOR_RANK];
+            uint64_t offset;
+            uint64_t bytes;
+            uint64_t checksum;
+        };
+
+        /** @brief The most threads that write payloads at once. More rarely helps a single disk. */
+        constexpr size_t MAX_WRITERS = 8;
+
+        uint64_t align_up(uint64_t value, uint64_t alignment)
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        size_t index_size(const std::vector<std::pair<std::string, Tensor>>& tensors)
+        {
+            size_t bytes = 0;
+            for (const auto& [name, t] : tensors)
+                bytes += sizeof(IndexRecord) + name.size();
+            return bytes;
+        }
+    } // namespace Anonymous
+
+    uint64_t archive_checksum(const void* data, size_t bytes)
+    {
+        constexpr uint64_t PRIME = 0x100000001b3ull;
+        uint64_t hash = 0xcbf29ce484222325ull;
+
+        const unsigned char* p = static_cast<const unsigned char*>(data);
+        size_t words = bytes / sizeof(uint64_t);
+        for (size_t i = 0; i < words; ++i)
+        {
+            uint64_t w;
+            std::memcpy(&w, p + i * sizeof(uint64_t), sizeof(uint64_t));
+            hash = (hash ^ w) * PRIME;
+        }
+
+        for (size_t i = words * sizeof(uint64_t); i < bytes; ++i)
+            hash = (hash ^ p[i]) * PRIME;
+
+        return hash;
+    }
+
+    void write_archive(Engine& e, const std::vector<std::pair<std::string, Tensor>>& tensors, const std::string& path)
+    {
+        std::unordered_set<std::string> seen;
+        for (const auto& [name, t] : tensors)
+        {
+            SB_THROW_IF(!seen.insert(name).second, "Tensor name '{}' appears twice in archive {}", name, path);
+            SB_THROW_IF(!t.is_contiguous(), "'{}' is a strided view, copy it to a contiguous tensor before saving", name);
+        }
+
+        e.execute().wait();
+
+        ArchiveHeader header;
+        header.count = static_cast<uint32_t>(tensors.size());
+        header.index_bytes = index_size(tensors);
+
+        std::vector<ArchiveEntry> entries(tensors.size());
+        uint64_t cursor = align_up(sizeof(ArchiveHeader) + header.index_bytes, ARCHIVE_ALIGNMENT);
+        for (size_t i = 0; i < tensors.size(); ++i)
+        {
+            const auto& [name, t] = tensors[i];
+            ArchiveEntry& entry = entries[i];
+            entry.name = name;
+            entry.dtype = t.dtype;
+            entry.layout = t.layout;
+            entry.rank = t.rank;
+            entry.shape = t.shape;
+            entry.offset = cursor;
+            entry.bytes = static_cast<uint64_t>(t.num_elements) * Core::element_size(t.dtype);
+            cursor = align_up(cursor + entry.bytes, ARCHIVE_ALIGNMENT);
+        }
+
+        File file(path, File::Mode::WRITE);
+        file.resize(cursor);
+
+        // Each thread takes the next tensor, so large and small payloads balance out.
+        std::atomic<size_t> next{0};
+        std::exception_ptr error;
+        std::mutex error_mutex;
+        auto writer = [&]()
+        {
+            std::vector<char> staging;
+            for (size_t i = next++; i < tensors.size(); i = next++)
+            {
+                try
+                {
+                    const Tensor& t = tensors[i].second;
+                    ArchiveEntry& entry = entries[i];
+                    const void* data = t.data();
+
+                    if (t.storage->strategy == SushiRuntime::Memory::AllocStrategy::DEVICE)
+                    {
+                        staging.resize(entry.bytes);
+                        e.get_context().get_queue().memcpy(staging.data(), data, entry.bytes).wait();
+                        data = staging.data();
+                    }
+
+                    entry.checksum = archive_checksum(data, entry.bytes);
+                    file.write_at(data, entry.bytes, entry.offset);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (!error) error = std::current_exception();
+                }
+            }
+        };
+
+        size_t threads = std::min({tensors.size(), MAX_WRITERS, static_cast<size_t>(std::max(1u, std::thread::hardware_concurrency()))});
+        std::vector<std::thread> pool;
+        for (size_t i = 1; i < threads; ++i)
+            pool.emplace_back(writer);
+        writer();
+        for (auto& th : pool)
+            th.join();
+
+        if (error) std::rethrow_exception(error);
+
+        // The index holds the checksums, so it is written last.
+        std::vector<char> index(sizeof(ArchiveHeader) + header.index_bytes);
+        std::memcpy(index.data(), &header, sizeof(ArchiveHeader));
+        char* p = index.data() + sizeof(ArchiveHeader);
+        for (const ArchiveEntry& entry : entries)
+        {
+            IndexRecord rec{};
+            rec.dtype = static_cast<int32_t>(entry.dtype);
+            rec.layout = static_cast<int32_t>(entry.layout);
+            rec.rank = entry.rank;
+            rec.name_bytes = static_cast<uint32_t>(entry.name.size());
+            std::copy(entry.shape.begin(), entry.shape.end(), rec.shape);
+            rec.offset = entry.offset;
+            rec.bytes = entry.bytes;
+            rec.checksum = entry.checksum;
+
+            std::memcpy(p, &rec, sizeof(IndexRecord));
+            std::memcpy(p + sizeof(IndexRecord), entry.name.data(), entry.name.size());
+            p += sizeof(IndexRecord) + entry.name.size();
+        }
+        file.write_at(index.data(), index.size(), 0);
+
+        SB_LOG_INFO("Saved archive {} with {} tensors ({} bytes)", path, tensors.size(), cursor);
+    }
+
+    Archive::Archive(Engine& e, const std::string& path) 
+        : engine_(e), file_(path, File::Mode::READ)
+    {
+        uint64_t file_bytes = file_.size();
+        SB_THROW_IF(file_bytes < sizeof(ArchiveHeader), "File is too small to be an archive: {}", path);
+
+        ArchiveHeader header;
+        file_.read_at(&header, sizeof(ArchiveHeader), 0);
+        SB_THROW_IF(std::string(header.magic, 7) != "SUSHIAR", "Invalid archive magic: {}", path);
+        SB_THROW_IF(header.version != 1, "Unsupported archive version {} in {}", header.version, path);
+        SB_THROW_IF(sizeof(ArchiveHeader) + header.index_bytes > file_bytes, "Truncated archive index: {}", path);
+
+        std::vector<char> index(header.index_bytes);
+        file_.read_at(index.data(), index.size(), sizeof(ArchiveHeader));
+
+        entries_.reserve(header.count);
+        const char* p = index.data();
+        const char* end = p + index.size();
+        for (uint32_t i = 0; i < header.count; ++i)
+        {
+            IndexRecord rec;
+            SB_THROW_IF(end - p < static_cast<ptrdiff_t>(sizeof(IndexRecord)), "Truncated archive index: {}", path);
+            std::memcpy(&rec, p, sizeof(IndexRecord));
+            p += sizeof(IndexRecord);
+            SB_THROW_IF(end - p < static_cast<ptrdiff_t>(rec.name_bytes), "Truncated archive index: {}", path);
+            SB_THROW_IF(rec.rank < 0 || rec.rank > static_cast<int32_t>(Core::MAX_TENSOR_RANK), "Invalid rank {} in {}", rec.rank, path);
+            SB_THROW_IF(rec.dtype < 0 || rec.dtype > static_cast<int32_t>(Core::DataType::COMPLEX64), "Unknown dtype {} in {}", rec.dtype, path);
+            SB_THROW_IF(rec.layout < 0 || rec.layout > static_cast<int32_t>(Core::Layout::COLUMN_MAJOR), "Unknown layout {} in {}", rec.layout, path);
+            SB_THROW_IF(rec.offset > file_bytes || rec.bytes > file_bytes - rec.offset, "Payload {} lies outside archive {}", i, path);
+
+            // load() allocates from the shape and reads rec.bytes, so the two must agree.
+            // The payload fits in the file, so a larger element count is already wrong.
+            uint64_t elements = 1;
+            for (int32_t d = 0; d < rec.rank; ++d)
+            {
+                SB_THROW_IF(rec.shape[d] < 0, "Negative dimension in record {} of {}", i, path);
+                uint64_t dim = static_cast<uint64_t>(rec.shape[d]);
+                SB_THROW_IF(dim != 0 && elements > file_bytes / dim, "Shape of record {} does not fit in {}", i, path);
+                elements *= dim;
+            }
+            SB_THROW_IF(rec.bytes != elements * Core::element_size(static_cast<Core::DataType>(rec.dtype)), 
+                        "Size of record {} does not match its shape in {}", i, path);
+
+            ArchiveEntry entry;
+            entry.name.assign(p, rec.name_bytes);
+            p += rec.name_bytes;
+            entry.dtype = static_cast<Core::DataType>(rec.dtype);
+            entry.layout = static_cast<Core::Layout>(rec.layout);
+            entry.rank = rec.rank;
+            std::copy(rec.shape, rec.shape + Core::MAX_TENSOR_RANK, entry.shape.begin());
+            entry.offset = rec.offset;
+            entry.bytes = rec.bytes;
+            entry.checksum = rec.checksum;
+
+            lookup_[entry.name] = entries_.size();
+            entries_.push_back(std::move(entry));
+        }
+
+        SB_LOG_INFO("Opened archive {} with {} tensors", path, entries_.size());
+    }
+
+    std::vector<std::string> Archive::names() const
+    {
+        std::vector<std::string> out;
+        out.reserve(entries_.size());
+        for (const ArchiveEntry& entry : entries_)
+            out.push_back(entry.name);
+        return out;
+    }
+
+    const ArchiveEntry& Archive::entry(const std::string& name) const
+    {
+        auto it = lookup_.find(name);
+        SB_THROW_IF(it == lookup_.end(), "Tensor '{}' is not in archive {}", name, file_.path());
+        return entries_[it->second];
+    }
+
+    Tensor Archive::load(const std::string& name, SushiRuntime::Memory::AllocStrategy strat, bool verify)
+    {
+        const ArchiveEntry& e = entry(name);
+
+        int64_t elements = 1;
+        for (int i = 0; i < e.rank; ++i)
+            elements *= e.shape[i];
+
+        Tensor flat = engine_.create_tensor({elements}, e.dtype, strat);
+        Tensor t(flat.storage, std::span<const int64_t>(e.shape.data(), e.rank), 0, e.layout, e.dtype);
+
+        read_payload(e, t, verify);
+        return t;
+    }
+
+    void Archive::load_into(const std::string& name, Tensor& t, bool verify)
+    {
+        const ArchiveEntry& e = entry(name);
+        SB_THROW_IF(t.dtype != e.dtype || t.rank != e.rank, "Tensor does not match '{}' in archive {}", name, file_.path());
+        SB_THROW_IF(!t.is_contiguous(), "Can not load '{}' into a strided view", name);
+        for (int i = 0; i < e.rank; ++i)
+            SB_THROW_IF(t.shape[i] != e.shape[i], "Dimension mismatch at index {} for '{}'", i, name);
+
+        // Tasks that still use the tensor must finish before it is overwritten.
+        engine_.execute().wait();
+        read_payload(e, t, verify);
+    }
+
+    Tensor Archive::map(const std::string& name)
+    {
+        const ArchiveEntry& e = entry(name);
+        if (!mapping_)
+            mapping_ = SushiRuntime::make_sushi<MappedStorage>(file_.path(), MapMode::READ_ONLY);
+
+        auto view = SushiRuntime::make_sushi<Storage>(SushiRuntime::sushi_ptr<Storage>(mapping_), e.offset, e.bytes);
+        Tensor t(view, std::span<const int64_t>(e.shape.data(), e.rank), 0, e.layout, e.dtype);
+        return t;
+    }
+
+    void Archive::read_payload(const ArchiveEntry& e, Tensor& t, bool verify)
+    {
+        if (t.storage->strategy == SushiRuntime::Memory::AllocStrategy::DEVICE && !verify)
+            engine_.parallel_io().read(file_, e.offset, t.data(), e.bytes, &engine_.get_context().get_queue());
+        else if (t.storage->strategy == SushiRuntime::Memory::AllocStrategy::DEVICE)
+        {
+            // The checksum needs the payload on the host, so it is not copied chunk by chunk.
+            std::vector<char> staging(e.bytes);
+            engine_.parallel_io().read(file_, e.offset, staging.data(), e.bytes);
+            SB_THROW_IF(verify && archive_checksum(staging.data(), e.bytes) != e.checksum, 
+                        "Checksum mismatch for '{}' in archive {}", e.name, file_.path());
+            engine_.get_context().get_queue().memcpy(t.data(), staging.data(), e.bytes).wait();
+        }
+        else
+        {
+            engine_.parallel_io().read(file_, e.offset, t.data(), e.bytes);
+            SB_THROW_IF(verify && archive_checksum(t.data(), e.bytes) != e.checksum, 
+                        "Checksum mismatch for '{}' in archive {}", e.name, file_.path());
+        }
+    }
+} // namespace SushiBLAS
@@ -0,0 +1,198 @@
+/**************************************************************************/
+/* file.cpp                                                               */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <utility>
+#include <algorithm>
+#include <SushiBLAS/io/file.hpp>
+#include <SushiBLAS/core/logger.hpp>
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/stat.h>
+#endif
+
+namespace SushiBLAS 
+{
+    File::File(const std::string& path, Mode mode, bool direct) : path_(path), mode_(mode)
+    {
+        #ifdef _WIN32
+            DWORD access = mode == Mode::READ ? GENERIC_READ : GENERIC_READ | GENERIC_WRITE;
+            DWORD share = mode == Mode::WRITE ? 0 : FILE_SHARE_READ | FILE_SHARE_WRITE;
+            DWORD create = mode == Mode::WRITE ? CREATE_ALWAYS : OPEN_EXISTING;
+            DWORD flags = FILE_ATTRIBUTE_NORMAL | (direct ? FILE_FLAG_NO_BUFFERING : 0);
+
+            HANDLE h = CreateFileA(path.c_str(), access, share, nullptr, create, flags, nullptr);
+            if (h == INVALID_HANDLE_VALUE && direct)
+                h = CreateFileA(path.c_str(), access, share, nullptr, create, FILE_ATTRIBUTE_NORMAL, nullptr);
+            else
+                direct_ = direct;
+
+            SB_THROW_IF(h == INVALID_HANDLE_VALUE, "Failed to open file: {}", path);
+            handle_ = reinterpret_cast<intptr_t>(h);
+        #else
+            int flags = mode == Mode::READ ? O_RDONLY : mode == Mode::WRITE ? O_RDWR | O_CREAT | O_TRUNC : O_RDWR;
+            int fd = -1;
+
+            #ifdef O_DIRECT
+                if (direct)
+                {
+                    fd = ::open(path.c_str(), flags | O_DIRECT, 0644);
+                    direct_ = fd >= 0;
+                }
+            #endif
+
+            if (fd < 0)
+                fd = ::open(path.c_str(), flags, 0644);
+
+            SB_THROW_IF(fd < 0, "Failed to open file: {}", path);
+            handle_ = fd;
+        #endif
+
+        if (direct && !direct_)
+            SB_LOG_WARN("Direct IO is not available for {}, using the page cache", path);
+    }
+
+    File::~File()
+    {
+        close();
+    }
+
+    File::File(File&& other) noexcept 
+        : path_(std::move(other.path_)), mode_(other.mode_), direct_(other.direct_), 
+          handle_(std::exchange(other.handle_, INVALID)) 
+    {
+    }
+
+    File& File::operator=(File&& other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            path_ = std::move(other.path_);
+            mode_ = other.mode_;
+            direct_ = other.direct_;
+            handle_ = std::exchange(other.handle_, INVALID);
+        }
+        return *this;
+    }
+
+    void File::close()
+    {
+        if (handle_ == INVALID) return;
+
+        #ifdef _WIN32
+            CloseHandle(reinterpret_cast<HANDLE>(handle_));
+        #else
+            ::close(static_cast<int>(handle_));
+        #endif
+        handle_ = INVALID;
+    }
+
+    void File::write_at(const void* data, size_t bytes, uint64_t offset)
+    {
+        const char* p = static_cast<const char*>(data);
+        while (bytes > 0)
+        {
+            #ifdef _WIN32
+                OVERLAPPED ov{};
+                ov.Offset = static_cast<DWORD>(offset);
+                ov.OffsetHigh = static_cast<DWORD>(offset >> 32);
+                DWORD done = 0;
+                DWORD chunk = static_cast<DWORD>(std::min<size_t>(bytes, 1u << 30));
+                bool ok = WriteFile(reinterpret_cast<HANDLE>(handle_), p, chunk, &done, &ov);
+                SB_THROW_IF(!ok, "Failed to write {} bytes at offset {} of {}", bytes, offset, path_);
+            #else
+                ssize_t done = ::pwrite(static_cast<int>(handle_), p, bytes, static_cast<off_t>(offset));
+                SB_THROW_IF(done < 0, "Failed to write {} bytes at offset {} of {}", bytes, offset, path_);
+            #endif
+
+            p += done;
+            bytes -= static_cast<size_t>(done);
+            offset += static_cast<uint64_t>(done);
+        }
+    }
+
+    void File::read_at(void* data, size_t bytes, uint64_t offset) const
+    {
+        char* p = static_cast<char*>(data);
+        while (bytes > 0)
+        {
+            #ifdef _WIN32
+                OVERLAPPED ov{};
+                ov.Offset = static_cast<DWORD>(offset);
+                ov.OffsetHigh = static_cast<DWORD>(offset >> 32);
+                DWORD done = 0;
+                DWORD chunk = static_cast<DWORD>(std::min<size_t>(bytes, 1u << 30));
+                bool ok = ReadFile(reinterpret_cast<HANDLE>(handle_), p, chunk, &done, &ov);
+                SB_THROW_IF(!ok, "Failed to read {} bytes at offset {} of {}", bytes, offset, path_);
+            #else
+                ssize_t done = ::pread(static_cast<int>(handle_), p, bytes, static_cast<off_t>(offset));
+                SB_THROW_IF(done < 0, "Failed to read {} bytes at offset {} of {}", bytes, offset, path_);
+            #endif
+
+            SB_THROW_IF(done == 0, "Unexpected end of file at offset {} of {}", offset, path_);
+            p += done;
+            bytes -= static_cast<size_t>(done);
+            offset += static_cast<uint64_t>(done);
+        }
+    }
+
+    uint64_t File::size() const
+    {
+        #ifdef _WIN32
+            LARGE_INTEGER size{};
+            SB_THROW_IF(!GetFileSizeEx(reinterpret_cast<HANDLE>(handle_), &size), "Failed to get the size of {}", path_);
+            return static_cast<uint64_t>(size.QuadPart);
+        #else
+            struct stat st{};
+            SB_THROW_IF(::fstat(static_cast<int>(handle_), &st) != 0, "Failed to get the size of {}", path_);
+            return static_cast<uint64_t>(st.st_size);
+        #endif
+    }
+
+    void File::resize(uint64_t bytes)
+    {
+        #ifdef _WIN32
+            FILE_END_OF_FILE_INFO info{};
+            info.EndOfFile.QuadPart = static_cast<LONGLONG>(bytes);
+            bool ok = SetFileInformationByHandle(reinterpret_cast<HANDLE>(handle_), FileEndOfFileInfo, &info, sizeof(info));
+            SB_THROW_IF(!ok, "Failed to resize {} to {} bytes", path_, bytes);
+        #else
+            SB_THROW_IF(::ftruncate(static_cast<int>(handle_), static_cast<off_t>(bytes)) != 0, 
+                        "Failed to resize {} to {} bytes", path_, bytes);
+        #endif
+    }
+} // namespace SushiBLAS
@@ -0,0 +1,107 @@
+/**************************************************************************/
+/* io_worker.cpp                                                          */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <exception>
+#include <SushiBLAS/core/logger.hpp>
+#include <SushiBLAS/io/io_worker.hpp>
+
+namespace SushiBLAS 
+{
+    IOWorker::~IOWorker()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        work_cv_.notify_all();
+
+        if (thread_.joinable()) 
+            thread_.join();
+    }
+
+    void IOWorker::submit(std::function<void()> job)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            jobs_.push_back(std::move(job));
+
+            if (!thread_.joinable())
+                thread_ = std::thread(&IOWorker::run, this);
+        }
+        work_cv_.notify_one();
+    }
+
+    void IOWorker::wait_idle()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        idle_cv_.wait(lock, [this] { return jobs_.empty() && running_ == 0; });
+    }
+
+    size_t IOWorker::pending() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return jobs_.size() + running_;
+    }
+
+    void IOWorker::run()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true)
+        {
+            // Queued jobs still run after stop, so no file is left half written.
+            work_cv_.wait(lock, [this] { return stop_ || !jobs_.empty(); });
+            if (jobs_.empty()) 
+                return;
+
+            std::function<void()> job = std::move(jobs_.front());
+            jobs_.pop_front();
+            ++running_;
+            lock.unlock();
+
+            try
+            {
+                job();
+            }
+            catch (const std::exception& e)
+            {
+                SB_LOG_ERROR("IO job failed: {}", e.what());
+            }
+            catch (...)
+            {
+                SB_LOG_ERROR("IO job failed with an unknown error");
+            }
+
+            lock.lock();
+            --running_;
+            if (jobs_.empty() && running_ == 0)
+                idle_cv_.notify_all();
+        }
+    }
+} // namespace SushiBLAS
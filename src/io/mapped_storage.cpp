@@ -0,0 +1,136 @@
+/**************************************************************************/
+/* mapped_storage.cpp                                                     */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <SushiBLAS/core/logger.hpp>
+#include <SushiBLAS/io/mapped_storage.hpp>
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
+namespace SushiBLAS 
+{
+    MappedStorage::MappedStorage(const std::string& path, MapMode mode)
+        : path_(path), mode_(mode)
+    {
+        #ifdef _WIN32
+            HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, 
+                                      OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            SB_THROW_IF(file == INVALID_HANDLE_VALUE, "Failed to open file for mapping: {}", path);
+
+            LARGE_INTEGER size{};
+            if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+            {
+                CloseHandle(file);
+                SB_THROW_IF(true, "Cannot map empty or unreadable file: {}", path);
+            }
+
+            DWORD protect = mode == MapMode::READ_ONLY ? PAGE_READONLY : PAGE_WRITECOPY;
+            DWORD access = mode == MapMode::READ_ONLY ? FILE_MAP_READ : FILE_MAP_COPY;
+
+            HANDLE mapping = CreateFileMappingA(file, nullptr, protect, 0, 0, nullptr);
+            void* base = mapping ? MapViewOfFile(mapping, access, 0, 0, 0) : nullptr;
+            if (!base)
+            {
+                if (mapping) CloseHandle(mapping);
+                CloseHandle(file);
+                SB_THROW_IF(true, "Failed to map file: {}", path);
+            }
+
+            file_handle_ = file;
+            mapping_handle_ = mapping;
+            size_bytes = static_cast<size_t>(size.QuadPart);
+        #else
+            int fd = ::open(path.c_str(), O_RDONLY);
+            SB_THROW_IF(fd < 0, "Failed to open file for mapping: {}", path);
+
+            struct stat st{};
+            if (::fstat(fd, &st) != 0 || st.st_size == 0)
+            {
+                ::close(fd);
+                SB_THROW_IF(true, "Cannot map empty or unreadable file: {}", path);
+            }
+
+            int prot = mode == MapMode::READ_ONLY ? PROT_READ : PROT_READ | PROT_WRITE;
+            int flags = mode == MapMode::READ_ONLY ? MAP_SHARED : MAP_PRIVATE;
+
+            void* base = ::mmap(nullptr, static_cast<size_t>(st.st_size), prot, flags, fd, 0);
+
+            // The mapping keeps its own reference to the file.
+            ::close(fd);
+            SB_THROW_IF(base == MAP_FAILED, "Failed to map file: {}", path);
+
+            size_bytes = static_cast<size_t>(st.st_size);
+        #endif
+
+        data_ptr = base;
+        alloc_base = base;
+        requested_bytes = size_bytes;
+        strategy = SushiRuntime::Memory::AllocStrategy::HOST;
+
+        SB_LOG_DEBUG("Mapped {} ({} bytes, {})", path, size_bytes, 
+                     mode == MapMode::READ_ONLY ? "read-only" : "copy-on-write");
+    }
+
+    MappedStorage::~MappedStorage()
+    {
+        if (!data_ptr) return;
+
+        #ifdef _WIN32
+            UnmapViewOfFile(data_ptr);
+            CloseHandle(static_cast<HANDLE>(mapping_handle_));
+            CloseHandle(static_cast<HANDLE>(file_handle_));
+        #else
+            ::munmap(data_ptr, size_bytes);
+        #endif
+
+        // Storage must not free this memory again.
+        data_ptr = nullptr;
+    }
+
+    size_t MappedStorage::page_size()
+    {
+        #ifdef _WIN32
+            SYSTEM_INFO info;
+            GetSystemInfo(&info);
+            return static_cast<size_t>(info.dwPageSize);
+        #else
+            return static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        #endif
+    }
+} // namespace SushiBLAS
@@ -0,0 +1,290 @@
+/**************************************************************************/
+/* parallel_io.cpp                                                        */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <atomic>
+#include <cstring>
+#include <optional>
+#include <algorithm>
+#include <exception>
+#include <SushiBLAS/core/logger.hpp>
+#include <SushiBLAS/io/parallel_io.hpp>
+
+namespace SushiBLAS 
+{
+    namespace 
+    {
+        constexpr size_t ALIGN = ParallelIO::DIRECT_ALIGNMENT;
+
+        /** @brief A staging buffer aligned for direct IO. It is pinned host memory if a queue is given. */
+        class StagingBuffer 
+        {
+            public:
+                StagingBuffer(size_t bytes, sycl::queue* queue) : queue_(queue)
+                {
+                    if (queue_)
+                        data_ = sycl::aligned_alloc_host(ALIGN, bytes, *queue_);
+                    else
+                        data_ = ::operator new(bytes, std::align_val_t(ALIGN));
+                    SB_THROW_IF(!data_, "Failed to allocate a staging buffer of {} bytes", bytes);
+                }
+
+                ~StagingBuffer()
+                {
+                    if (queue_)
+                        sycl::free(data_, *queue_);
+                    else
+                        ::operator delete(data_, std::align_val_t(ALIGN));
+                }
+
+                StagingBuffer(const StagingBuffer&) = delete;
+                StagingBuffer& operator=(const StagingBuffer&) = delete;
+
+                void* data() const { return data_; }
+
+            private:
+                sycl::queue* queue_;
+                void* data_ = nullptr;
+        };
+
+        /** @brief How a transfer is split: an aligned body in chunks, then a short tail. */
+        struct TransferPlan 
+        {
+            size_t chunk = 0;
+            size_t body = 0;
+            size_t chunks = 0;
+            bool staged = false;
+            std::optional<File> direct_file;
+        };
+
+        TransferPlan plan_transfer(const IOOptions& options, const File& file, uint64_t offset, size_t bytes, bool device)
+        {
+            TransferPlan plan;
+            plan.chunk = std::max(ALIGN, (options.chunk_bytes + ALIGN - 1) / ALIGN * ALIGN);
+            plan.body = bytes;
+
+            // Direct IO needs aligned offsets, so only an aligned start can use it.
+            if (options.direct && offset % ALIGN == 0 && bytes >= ALIGN)
+            {
+                File::Mode mode = file.mode() == File::Mode::READ ? File::Mode::READ : File::Mode::UPDATE;
+                plan.direct_file.emplace(file.path(), mode, true);
+                if (plan.direct_file->direct())
+                    plan.body = bytes / ALIGN * ALIGN;
+                else
+                    plan.direct_file.reset();
+            }
+
+            plan.chunks = (plan.body + plan.chunk - 1) / plan.chunk;
+            plan.staged = device || plan.direct_file.has_value();
+            return plan;
+        }
+    } // namespace Anonymous
+
+    ParallelIO::~ParallelIO()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+
+        for (auto& t : threads_)
+            t.join();
+    }
+
+    void ParallelIO::set_options(const IOOptions& options)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        options_ = options;
+    }
+
+    IOOptions ParallelIO::options() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return options_;
+    }
+
+    void ParallelIO::write(File& file, uint64_t offset, const void* src, size_t bytes, sycl::queue* device_queue)
+    {
+        IOOptions opt = options();
+        TransferPlan plan = plan_transfer(opt, file, offset, bytes, device_queue != nullptr);
+        File& target = plan.direct_file ? *plan.direct_file : file;
+        const char* base = static_cast<const char*>(src);
+
+        std::atomic<size_t> next{0};
+        run_workers(std::min(opt.threads, plan.chunks), [&]()
+        {
+            std::optional<StagingBuffer> staging;
+            if (plan.staged) staging.emplace(std::min(plan.chunk, plan.body), device_queue);
+
+            for (size_t i = next++; i < plan.chunks; i = next++)
+            {
+                size_t off = i * plan.chunk;
+                size_t len = std::min(plan.chunk, plan.body - off);
+                const void* p = base + off;
+
+                if (device_queue)
+                    device_queue->memcpy(staging->data(), p, len).wait();
+                else if (plan.staged)
+                    std::memcpy(staging->data(), p, len);
+
+                target.write_at(plan.staged ? staging->data() : p, len, offset + off);
+            }
+        });
+
+        if (plan.body < bytes)
+        {
+            size_t len = bytes - plan.body;
+            std::vector<char> tail(len);
+            if (device_queue)
+                device_queue->memcpy(tail.data(), base + plan.body, len).wait();
+            else
+                std::memcpy(tail.data(), base + plan.body, len);
+            file.write_at(tail.data(), len, offset + plan.body);
+        }
+    }
+
+    void ParallelIO::read(const File& file, uint64_t offset, void* dst, size_t bytes, sycl::queue* device_queue)
+    {
+        IOOptions opt = options();
+        TransferPlan plan = plan_transfer(opt, file, offset, bytes, device_queue != nullptr);
+        const File& source = plan.direct_file ? *plan.direct_file : file;
+        char* base = static_cast<char*>(dst);
+
+        std::atomic<size_t> next{0};
+        run_workers(std::min(opt.threads, plan.chunks), [&]()
+        {
+            std::optional<StagingBuffer> staging;
+            if (plan.staged) staging.emplace(std::min(plan.chunk, plan.body), device_queue);
+
+            for (size_t i = next++; i < plan.chunks; i = next++)
+            {
+                size_t off = i * plan.chunk;
+                size_t len = std::min(plan.chunk, plan.body - off);
+
+                if (!plan.staged)
+                {
+                    source.read_at(base + off, len, offset + off);
+                    continue;
+                }
+
+                source.read_at(staging->data(), len, offset + off);
+                if (device_queue)
+                    device_queue->memcpy(base + off, staging->data(), len).wait();
+                else
+                    std::memcpy(base + off, staging->data(), len);
+            }
+        });
+
+        if (plan.body < bytes)
+        {
+            size_t len = bytes - plan.body;
+            std::vector<char> tail(len);
+            file.read_at(tail.data(), len, offset + plan.body);
+            if (device_queue)
+                device_queue->memcpy(base + plan.body, tail.data(), len).wait();
+            else
+                std::memcpy(base + plan.body, tail.data(), len);
+        }
+    }
+
+    void ParallelIO::run_workers(size_t workers, const std::function<void()>& worker)
+    {
+        if (workers <= 1)
+        {
+            worker();
+            return;
+        }
+
+        ensure_threads(workers - 1);
+
+        std::mutex done_mutex;
+        std::condition_variable done_cv;
+        size_t remaining = workers - 1;
+        std::exception_ptr error;
+
+        auto guarded = [&]()
+        {
+            try
+            {
+                worker();
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(done_mutex);
+                if (!error) error = std::current_exception();
+            }
+        };
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (size_t i = 0; i + 1 < workers; ++i)
+            {
+                jobs_.push_back([&]()
+                {
+                    guarded();
+                    std::lock_guard<std::mutex> done_lock(done_mutex);
+                    if (--remaining == 0) done_cv.notify_one();
+                });
+            }
+        }
+        cv_.notify_all();
+
+        guarded();
+
+        std::unique_lock<std::mutex> lock(done_mutex);
+        done_cv.wait(lock, [&] { return remaining == 0; });
+
+        if (error) std::rethrow_exception(error);
+    }
+
+    void ParallelIO::ensure_threads(size_t count)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        while (threads_.size() < count)
+            threads_.emplace_back(&ParallelIO::run, this);
+    }
+
+    void ParallelIO::run()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true)
+        {
+            cv_.wait(lock, [this] { return stop_ || !jobs_.empty(); });
+            if (stop_ && jobs_.empty()) 
+                return;
+
+            std::function<void()> job = std::move(jobs_.front());
+            jobs_.pop_front();
+            lock.unlock();
+            job();
+            lock.lock();
+        }
+    }
+} // namespace SushiBLAS
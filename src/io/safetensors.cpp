@@ -0,0 +1,487 @@
+/**************************************************************************/
+/* safetensors.cpp                                                        */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <span>
+#include <format>
+#include <cstring>
+#include <algorithm>
+#include <unordered_set>
+#include <SushiBLAS/engine.hpp>
+#include <SushiBLAS/io/file.hpp>
+#include <SushiBLAS/io/safetensors.hpp>
+#include <SushiBLAS/io/parallel_io.hpp>
+
+namespace SushiBLAS 
+{
+    namespace 
+    {
+        /** @brief The largest header accepted, as in the reference implementation. */
+        constexpr uint64_t MAX_HEADER_BYTES = uint64_t(100) << 20;
+
+        bool dtype_from_string(const std::string& s, Core::DataType& dtype)
+        {
+            if (s == "F32") dtype = Core::DataType::FLOAT32;
+            else if (s == "F16") dtype = Core::DataType::HALF;
+            else if (s == "F64") dtype = Core::DataType::FLOAT64;
+            else if (s == "C64") dtype = Core::DataType::COMPLEX32;
+            else return false;
+            return true;
+        }
+
+        const char* dtype_to_string(Core::DataType dtype)
+        {
+            switch (dtype)
+            {
+                case Core::DataType::HALF: return "F16";
+                case Core::DataType::FLOAT64: return "F64";
+                case Core::DataType::COMPLEX32: return "C64";
+                case Core::DataType::FLOAT32: return "F32";
+                default: return nullptr;
+            }
+        }
+
+        /** @brief A small JSON reader for the safetensors header. Values it does not need are skipped. */
+        class JsonReader 
+        {
+            public:
+                JsonReader(const char* begin, const char* end, const std::string& path) 
+                    : p_(begin), end_(end), path_(path) {}
+
+                /** @brief Consume a character, or fail if the next one differs. */
+                void expect(char c)
+                {
+                    skip_space();
+                    SB_THROW_IF(p_ >= end_ || *p_ != c, "Expected '{}' in the safetensors header of {}", c, path_);
+                    ++p_;
+                }
+
+                /** @brief Consume a character if it is next. */
+                bool accept(char c)
+                {
+                    skip_space();
+                    if (p_ < end_ && *p_ == c)
+                    {
+                        ++p_;
+                        return true;
+                    }
+                    return false;
+                }
+
+                std::string read_string()
+                {
+                    expect('"');
+                    std::string out;
+                    while (true)
+                    {
+                        SB_THROW_IF(p_ >= end_, "Unterminated string in the safetensors header of {}", path_);
+                        char c = *p_++;
+                        if (c == '"') break;
+                        if (c != '\\')
+                        {
+                            out += c;
+                            continue;
+                        }
+
+                        SB_THROW_IF(p_ >= end_, "Unterminated string in the safetensors header of {}", path_);
+                        char e = *p_++;
+                        switch (e)
+                        {
+                            case 'b': out += '\b'; break;
+                            case 'f': out += '\f'; break;
+                            case 'n': out += '\n'; break;
+                            case 'r': out += '\r'; break;
+                            case 't': out += '\t'; break;
+                            case 'u': append_utf8(out, read_hex4()); break;
+                            default: out += e; break;
+                        }
+                    }
+                    return out;
+                }
+
+                int64_t read_int()
+                {
+                    skip_space();
+                    const char* start = p_;
+                    if (p_ < end_ && *p_ == '-') ++p_;
+                    int64_t value = 0;
+                    while (p_ < end_ && *p_ >= '0' && *p_ <= '9')
+                        value = value * 10 + (*p_++ - '0');
+                    SB_THROW_IF(p_ == start || (p_ == start + 1 && *start == '-'), "Expected a number in the safetensors header of {}", path_);
+                    return *start == '-' ? -value : value;
+                }
+
+                std::vector<int64_t> read_int_array()
+                {
+                    std::vector<int64_t> out;
+                    expect('[');
+                    if (accept(']')) return out;
+                    do out.push_back(read_int());
+                    while (accept(','));
+                    expect(']');
+                    return out;
+                }
+
+                /** @brief Skip any value, including nested objects and arrays. */
+                void skip_value()
+                {
+                    skip_space();
+                    SB_THROW_IF(p_ >= end_, "Unexpected end of the safetensors header of {}", path_);
+                    if (*p_ == '"')
+                        read_string();
+                    else if (*p_ == '{' || *p_ == '[')
+                    {
+                        char close = *p_ == '{' ? '}' : ']';
+                        ++p_;
+                        if (accept(close)) return;
+                        do
+                        {
+                            if (close == '}')
+                            {
+                                read_string();
+                                expect(':');
+                            }
+                            skip_value();
+                        } 
+                        while (accept(','));
+                        expect(close);
+                    }
+                    else
+                        while (p_ < end_ && *p_ != ',' && *p_ != '}' && *p_ != ']' && !is_space(*p_)) ++p_;
+                }
+
+            private:
+                static bool is_space(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+
+                void skip_space()
+                {
+                    while (p_ < end_ && is_space(*p_)) ++p_;
+                }
+
+                uint32_t read_hex4()
+                {
+                    SB_THROW_IF(end_ - p_ < 4, "Invalid escape in the safetensors header of {}", path_);
+                    uint32_t value = 0;
+                    for (int i = 0; i < 4; ++i)
+                    {
+                        char c = *p_++;
+                        value <<= 4;
+                        if (c >= '0' && c <= '9') value |= c - '0';
+                        else if (c >= 'a' && c <= 'f') value |= c - 'a' + 10;
+                        else if (c >= 'A' && c <= 'F') value |= c - 'A' + 10;
+                        else SB_THROW_IF(true, "Invalid escape in the safetensors header of {}", path_);
+                    }
+                    return value;
+                }
+
+                /** @brief Append a code point, joining a UTF-16 surrogate pair if one follows. */
+                void append_utf8(std::string& out, uint32_t cp)
+                {
+                    if (cp >= 0xD800 && cp <= 0xDBFF && end_ - p_ >= 6 && p_[0] == '\\' && p_[1] == 'u')
+                    {
+                        p_ += 2;
+                        uint32_t low = read_hex4();
+                        cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                    }
+
+                    if (cp < 0x80) out += static_cast<char>(cp);
+                    else if (cp < 0x800)
+                    {
+                        out += static_cast<char>(0xC0 | (cp >> 6));
+                        out += static_cast<char>(0x80 | (cp & 0x3F));
+                    }
+                    else if (cp < 0x10000)
+                    {
+                        out += static_cast<char>(0xE0 | (cp >> 12));
+                        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                        out += static_cast<char>(0x80 | (cp & 0x3F));
+                    }
+                    else
+                    {
+                        out += static_cast<char>(0xF0 | (cp >> 18));
+                        out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+                        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                        out += static_cast<char>(0x80 | (cp & 0x3F));
+                    }
+                }
+
+                const char* p_;
+                const char* end_;
+                const std::string& path_;
+        };
+
+        void append_json_string(std::string& out, const std::string& s)
+        {
+            out += '"';
+            for (char c : s)
+            {
+                if (c == '"' || c == '\\') 
+                {
+                    out += '\\';
+                    out += c;
+                }
+                else if (static_cast<unsigned char>(c) < 0x20)
+                    out += std::format("\\u{:04x}", static_cast<unsigned>(c));
+                else 
+                    out += c;
+            }
+            out += '"';
+        }
+    } // namespace Anonymous
+
+    SafeTensors::SafeTensors(Engine& e, const std::string& path, MapMode mode) 
+        : engine_(e), mapping_(SushiRuntime::make_sushi<MappedStorage>(path, mode))
+    {
+        const char* base = static_cast<const char*>(mapping_->data_ptr);
+        uint64_t file_bytes = mapping_->size_bytes;
+        SB_THROW_IF(file_bytes < 8, "File is too small to be safetensors: {}", path);
+
+        // The header size is a little-endian u64.
+        uint64_t header_bytes = 0;
+        for (int i = 7; i >= 0; --i)
+            header_bytes = (header_bytes << 8) | static_cast<unsigned char>(base[i]);
+
+        SB_THROW_IF(header_bytes > MAX_HEADER_BYTES || 8 + header_bytes > file_bytes, "Invalid safetensors header size in {}", path);
+        uint64_t data_start = 8 + header_bytes;
+
+        JsonReader json(base + 8, base + data_start, path);
+        json.expect('{');
+        if (!json.accept('}'))
+        {
+            do
+            {
+                std::string name = json.read_string();
+                json.expect(':');
+
+                if (name == "__metadata__")
+                {
+                    json.expect('{');
+                    if (json.accept('}')) continue;
+                    do
+                    {
+                        std::string key = json.read_string();
+                        json.expect(':');
+                        metadata_[key] = json.read_string();
+                    } 
+                    while (json.accept(','));
+                    json.expect('}');
+                    continue;
+                }
+
+                std::string dtype_name;
+                std::vector<int64_t> shape;
+                std::vector<int64_t> offsets;
+
+                json.expect('{');
+                if (!json.accept('}'))
+                {
+                    do
+                    {
+                        std::string key = json.read_string();
+                        json.expect(':');
+                        if (key == "dtype") dtype_name = json.read_string();
+                        else if (key == "shape") shape = json.read_int_array();
+                        else if (key == "data_offsets") offsets = json.read_int_array();
+                        else json.skip_value();
+                    } 
+                    while (json.accept(','));
+                    json.expect('}');
+                }
+
+                SB_THROW_IF(offsets.size() != 2 || offsets[0] < 0 || offsets[1] < offsets[0], 
+                            "Invalid data_offsets for '{}' in {}", name, path);
+                SB_THROW_IF(data_start + static_cast<uint64_t>(offsets[1]) > file_bytes, 
+                            "Data of '{}' lies outside {}", name, path);
+
+                SafeTensorsEntry entry;
+                if (!dtype_from_string(dtype_name, entry.dtype))
+                {
+                    SB_LOG_DEBUG("Skipping '{}' in {}: dtype {} is not supported", name, path, dtype_name);
+                    skipped_.push_back(name);
+                    continue;
+                }
+
+                SB_THROW_IF(shape.size() > Core::MAX_TENSOR_RANK, "Rank {} of '{}' exceeds limit of {}", shape.size(), name, Core::MAX_TENSOR_RANK);
+
+                int64_t elements = 1;
+                for (size_t i = 0; i < shape.size(); ++i)
+                {
+                    SB_THROW_IF(shape[i] < 0, "Negative dimension in '{}' of {}", name, path);
+                    entry.shape[i] = shape[i];
+                    elements *= shape[i];
+                }
+
+                entry.name = name;
+                entry.rank = static_cast<int32_t>(shape.size());
+                entry.offset = data_start + static_cast<uint64_t>(offsets[0]);
+                entry.bytes = static_cast<uint64_t>(offsets[1] - offsets[0]);
+                SB_THROW_IF(entry.bytes != static_cast<uint64_t>(elements) * Core::element_size(entry.dtype), 
+                            "Size of '{}' does not match its shape in {}", name, path);
+
+                lookup_[entry.name] = entries_.size();
+                entries_.push_back(std::move(entry));
+            } 
+            while (json.accept(','));
+            json.expect('}');
+        }
+
+        SB_LOG_INFO("Opened safetensors {} with {} tensors", path, entries_.size());
+    }
+
+    std::vector<std::string> SafeTensors::names() const
+    {
+        std::vector<std::string> out;
+        out.reserve(entries_.size());
+        for (const SafeTensorsEntry& entry : entries_)
+            out.push_back(entry.name);
+        return out;
+    }
+
+    const SafeTensorsEntry& SafeTensors::entry(const std::string& name) const
+    {
+        auto it = lookup_.find(name);
+        SB_THROW_IF(it == lookup_.end(), "Tensor '{}' is not in {}", name, mapping_->path());
+        return entries_[it->second];
+    }
+
+    Tensor SafeTensors::get(const std::string& name)
+    {
+        const SafeTensorsEntry& e = entry(name);
+        if (e.offset % Core::element_size(e.dtype) != 0)
+        {
+            SB_LOG_DEBUG("'{}' in {} is not aligned, copying it", name, mapping_->path());
+            return load(name);
+        }
+
+        auto view = SushiRuntime::make_sushi<Storage>(SushiRuntime::sushi_ptr<Storage>(mapping_), e.offset, e.bytes);
+        Tensor t(view, std::span<const int64_t>(e.shape.data(), e.rank), 0, Core::Layout::ROW_MAJOR, e.dtype);
+        return t;
+    }
+
+    Tensor SafeTensors::load(const std::string& name, SushiRuntime::Memory::AllocStrategy strat)
+    {
+        const SafeTensorsEntry& e = entry(name);
+
+        int64_t elements = 1;
+        for (int i = 0; i < e.rank; ++i)
+            elements *= e.shape[i];
+
+        Tensor flat = engine_.create_tensor({elements}, e.dtype, strat);
+        Tensor t(flat.storage, std::span<const int64_t>(e.shape.data(), e.rank), 0, Core::Layout::ROW_MAJOR, e.dtype);
+
+        const char* src = static_cast<const char*>(mapping_->data_ptr) + e.offset;
+        if (strat == SushiRuntime::Memory::AllocStrategy::DEVICE)
+            engine_.get_context().get_queue().memcpy(t.data(), src, e.bytes).wait();
+        else
+            std::memcpy(t.data(), src, e.bytes);
+        return t;
+    }
+
+    void write_safetensors(Engine& e, const std::vector<std::pair<std::string, Tensor>>& tensors, const std::string& path, 
+                           const std::map<std::string, std::string>& metadata)
+    {
+        std::unordered_set<std::string> seen;
+        for (const auto& [name, t] : tensors)
+        {
+            SB_THROW_IF(!seen.insert(name).second, "Tensor name '{}' appears twice in {}", name, path);
+            SB_THROW_IF(!dtype_to_string(t.dtype), "safetensors has no dtype for '{}'", name);
+            SB_THROW_IF(!t.is_contiguous(), "'{}' is a strided view, copy it to a contiguous tensor before saving", name);
+            SB_THROW_IF(t.layout == Core::Layout::COLUMN_MAJOR && t.rank > 1, 
+                        "safetensors stores row-major data, but '{}' is COLUMN_MAJOR", name);
+        }
+
+        // Larger elements first keeps every tensor aligned to its element size.
+        std::vector<size_t> order(tensors.size());
+        for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) 
+        {
+            return Core::element_size(tensors[a].second.dtype) > Core::element_size(tensors[b].second.dtype);
+        });
+
+        std::string header = "{";
+        if (!metadata.empty())
+        {
+            header += "\"__metadata__\":{";
+            bool first = true;
+            for (const auto& [key, value] : metadata)
+            {
+                if (!first) header += ',';
+                first = false;
+                append_json_string(header, key);
+                header += ':';
+                append_json_string(header, value);
+            }
+            header += '}';
+        }
+
+        std::vector<uint64_t> offsets(tensors.size());
+        uint64_t cursor = 0;
+        for (size_t i : order)
+        {
+            const auto& [name, t] = tensors[i];
+            uint64_t bytes = static_cast<uint64_t>(t.num_elements) * Core::element_size(t.dtype);
+            offsets[i] = cursor;
+
+            if (header.size() > 1) header += ',';
+            append_json_string(header, name);
+            header += std::format(":{{\"dtype\":\"{}\",\"shape\":[", dtype_to_string(t.dtype));
+            for (int d = 0; d < t.rank; ++d)
+                header += std::format("{}{}", d ? "," : "", t.shape[d]);
+            header += std::format("],\"data_offsets\":[{},{}]}}", cursor, cursor + bytes);
+            cursor += bytes;
+        }
+        header += '}';
+
+        // Pad with spaces so the data starts at an 8-byte boundary.
+        while ((8 + header.size()) % 8 != 0) header += ' ';
+
+        e.execute().wait();
+
+        File file(path, File::Mode::WRITE);
+        unsigned char size_bytes[8];
+        for (int i = 0; i < 8; ++i)
+            size_bytes[i] = static_cast<unsigned char>(static_cast<uint64_t>(header.size()) >> (8 * i));
+        file.write_at(size_bytes, 8, 0);
+        file.write_at(header.data(), header.size(), 8);
+
+        uint64_t data_start = 8 + header.size();
+        for (size_t i : order)
+        {
+            const Tensor& t = tensors[i].second;
+            sycl::queue* device_queue = nullptr;
+            if (t.storage->strategy == SushiRuntime::Memory::AllocStrategy::DEVICE)
+                device_queue = &e.get_context().get_queue();
+
+            size_t bytes = static_cast<size_t>(t.num_elements) * Core::element_size(t.dtype);
+            if (bytes) e.parallel_io().write(file, data_start + offsets[i], t.data(), bytes, device_queue);
+        }
+
+        SB_LOG_INFO("Saved safetensors {} with {} tensors", path, tensors.size());
+    }
+} // namespace SushiBLAS
@@ -0,0 +1,406 @@
+/**************************************************************************/
+/* caching_allocator.cpp                                                  */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <bit>
+#include <thread>
+#include <functional>
+#include <SushiBLAS/core/logger.hpp>
+#include <SushiBLAS/memory/caching_allocator.hpp>
+
+namespace SushiBLAS 
+{
+    using SushiRuntime::Memory::AllocStrategy;
+    using SushiRuntime::Memory::MemoryPage;
+
+    namespace 
+    {
+        /** @brief Slots per slab, one bit of the page bitmask each. */
+        constexpr size_t SLAB_SLOTS = 64;
+
+        constexpr size_t MIN_CLASS = SushiRuntime::Core::DEFAULT_ALIGNMENT;
+        constexpr size_t MB = size_t(1) << 20;
+
+        size_t strategy_index(AllocStrategy strategy)
+        {
+            return static_cast<size_t>(strategy);
+        }
+
+        uint64_t free_key(size_t bytes, AllocStrategy strategy)
+        {
+            return (static_cast<uint64_t>(bytes) << 2) | strategy_index(strategy);
+        }
+
+        /** @brief Check if every event of a fence completed. A completed fence is dropped. */
+        template<typename Fence>
+        bool fence_done(Fence& fence)
+        {
+            if (!fence) return true;
+            for (const sycl::event& e : *fence)
+                if (e.get_info<sycl::info::event::command_execution_status>() != sycl::info::event_command_status::complete) 
+                    return false;
+
+            fence.reset();
+            return true;
+        }
+
+        template<typename Fence>
+        void wait_fence(const Fence& fence)
+        {
+            if (!fence) return;
+            for (sycl::event e : *fence) e.wait();
+        }
+    } // namespace Anonymous
+
+    CachingAllocator::CachingAllocator(SushiRuntime::sushi_ptr<SushiRuntime::Memory::USMAllocator> upstream) 
+        : upstream_(std::move(upstream))
+    {
+        SB_THROW_IF(!upstream_, "Upstream allocator cannot be null");
+    }
+
+    CachingAllocator::~CachingAllocator()
+    {
+        for (Shard& shard : shards_)
+        {
+            for (auto& [key, list] : shard.free)
+            {
+                for (FreeBlock& block : list)
+                {
+                    wait_fence(block.fence);
+                    upstream_->deallocate(block.ptr);
+                }
+            }
+        }
+
+        for (SlabList& list : slabs_)
+        {
+            for (FreeBlock& block : list.pending) 
+                wait_fence(block.fence);
+            for (auto& page : list.pages) 
+                upstream_->deallocate(page->start_ptr);
+        }
+    }
+
+    size_t CachingAllocator::size_class(size_t bytes)
+    {
+        if (bytes <= MIN_CLASS) return MIN_CLASS;
+        if (bytes <= SMALL_LIMIT) return std::bit_ceil(bytes);
+        if (bytes >= 256 * MB) return (bytes + 2 * MB - 1) / (2 * MB) * (2 * MB);
+
+        size_t step = std::bit_floor(bytes) / 4;
+        return (bytes + step - 1) / step * step;
+    }
+
+    CachingAllocator::SlabList& CachingAllocator::slab_list(size_t bytes, AllocStrategy strategy)
+    {
+        size_t cls = static_cast<size_t>(std::countr_zero(bytes) - std::countr_zero(MIN_CLASS));
+        return slabs_[strategy_index(strategy) * SMALL_CLASSES + cls];
+    }
+
+    CachingAllocator::LiveShard& CachingAllocator::live_shard(void* ptr)
+    {
+        return live_[(reinterpret_cast<uintptr_t>(ptr) / MIN_CLASS) % SHARDS];
+    }
+
+    CachingAllocator::Shard& CachingAllocator::own_shard()
+    {
+        static thread_local size_t index = std::hash<std::thread::id>{}(std::this_thread::get_id()) % SHARDS;
+        return shards_[index];
+    }
+
+    CachingAllocator::Fence CachingAllocator::current_fence()
+    {
+        std::lock_guard<std::mutex> lock(fence_mutex_);
+        return fence_;
+    }
+
+    void CachingAllocator::set_fence(std::vector<sycl::event> events)
+    {
+        Fence fence = events.empty() ? nullptr : std::make_shared<const std::vector<sycl::event>>(std::move(events));
+
+        std::lock_guard<std::mutex> lock(fence_mutex_);
+        fence_ = std::move(fence);
+    }
+
+    void* CachingAllocator::allocate(size_t bytes, AllocStrategy strategy, size_t alignment)
+    {
+        if (bytes == 0) return nullptr;
+
+        Block block;
+        block.strategy = strategy;
+        void* ptr = nullptr;
+
+        if (alignment > MIN_CLASS)
+        {
+            // blocks are only aligned to DEFAULT_ALIGNMENT, so stricter requests bypass the cache
+            ptr = upstream_->allocate(bytes, strategy, alignment);
+            block.bytes = bytes;
+            block.cached = false;
+            if (ptr)
+            {
+                reserved_.fetch_add(bytes, std::memory_order_relaxed);
+                misses_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        else
+        {
+            block.bytes = size_class(bytes);
+            ptr = block.bytes <= SMALL_LIMIT ? allocate_small(block.bytes, strategy, block.page) 
+                                             : allocate_large(block.bytes, strategy);
+        }
+
+        if (!ptr) return nullptr;
+
+        {
+            LiveShard& live = live_shard(ptr);
+            std::lock_guard<std::mutex> lock(live.mutex);
+            live.blocks[ptr] = block;
+        }
+
+        size_t now = in_use_.fetch_add(block.bytes, std::memory_order_relaxed) + block.bytes;
+        size_t peak = peak_.load(std::memory_order_relaxed);
+        while (now > peak && !peak_.compare_exchange_weak(peak, now, std::memory_order_relaxed)) {}
+
+        return ptr;
+    }
+
+    void* CachingAllocator::allocate_small(size_t bytes, AllocStrategy strategy, MemoryPage*& page)
+    {
+        SlabList& list = slab_list(bytes, strategy);
+
+        auto find_page = [&](void* ptr) -> MemoryPage* 
+        {
+            for (MemoryPage* p = list.root.load(std::memory_order_acquire); p; p = p->next.load(std::memory_order_acquire))
+            {
+                char* start = static_cast<char*>(p->start_ptr);
+                if (ptr >= start && ptr < start + SLAB_SLOTS * p->slot_size) return p;
+            }
+            return nullptr;
+        };
+
+        // the common case takes a free bit without any lock
+        void* ptr = pool_.allocate_from_pool(list.root.load(std::memory_order_acquire));
+        if (!ptr)
+        {
+            std::lock_guard<std::mutex> lock(list.mutex);
+            release_pending(list);
+            ptr = pool_.allocate_from_pool(list.root.load(std::memory_order_acquire));
+
+            if (!ptr)
+            {
+                void* slab = upstream_->allocate(bytes * SLAB_SLOTS, strategy);
+                if (!slab) return nullptr;
+                reserved_.fetch_add(bytes * SLAB_SLOTS, std::memory_order_relaxed);
+                misses_.fetch_add(1, std::memory_order_relaxed);
+
+                auto owned = std::make_unique<MemoryPage>();
+                owned->start_ptr = slab;
+                owned->slot_size = bytes;
+                owned->numa_node_id = -1;
+                MemoryPage* fresh = owned.get();
+                list.pages.push_back(std::move(owned));
+
+                // take the first slot before other threads can see the page
+                ptr = pool_.allocate_from_pool(fresh);
+                if (list.tail) list.tail->next.store(fresh, std::memory_order_release);
+                else list.root.store(fresh, std::memory_order_release);
+                list.tail = fresh;
+
+                page = fresh;
+                return ptr;
+            }
+        }
+
+        hits_.fetch_add(1, std::memory_order_relaxed);
+        page = find_page(ptr);
+        return ptr;
+    }
+
+    void* CachingAllocator::allocate_large(size_t bytes, AllocStrategy strategy)
+    {
+        uint64_t key = free_key(bytes, strategy);
+        Shard& own = own_shard();
+
+        void* ptr = take_free(own, key);
+        for (size_t i = 0; !ptr && i < SHARDS; ++i)
+            if (&shards_[i] != &own) ptr = take_free(shards_[i], key);
+
+        if (ptr)
+        {
+            hits_.fetch_add(1, std::memory_order_relaxed);
+            return ptr;
+        }
+
+        ptr = upstream_->allocate(bytes, strategy);
+
+        // out of memory: give the cached blocks back and try once more
+        if (!ptr && trim() > 0) 
+            ptr = upstream_->allocate(bytes, strategy);
+
+        if (ptr)
+        {
+            reserved_.fetch_add(bytes, std::memory_order_relaxed);
+            misses_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return ptr;
+    }
+
+    void* CachingAllocator::take_free(Shard& shard, uint64_t key)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.free.find(key);
+        if (it == shard.free.end()) return nullptr;
+
+        std::vector<FreeBlock>& list = it->second;
+        for (size_t i = list.size(); i-- > 0;)
+        {
+            if (!fence_done(list[i].fence)) continue;
+
+            void* ptr = list[i].ptr;
+            list[i] = std::move(list.back());
+            list.pop_back();
+            return ptr;
+        }
+        return nullptr;
+    }
+
+    void CachingAllocator::release_pending(SlabList& list)
+    {
+        for (size_t i = list.pending.size(); i-- > 0;)
+        {
+            FreeBlock& block = list.pending[i];
+            if (!fence_done(block.fence)) continue;
+
+            pool_.deallocate_to_page(*block.page, block.ptr);
+            block = std::move(list.pending.back());
+            list.pending.pop_back();
+        }
+    }
+
+    void CachingAllocator::deallocate(void* ptr)
+    {
+        if (!ptr) return;
+
+        Block block;
+        {
+            LiveShard& live = live_shard(ptr);
+            std::lock_guard<std::mutex> lock(live.mutex);
+            auto it = live.blocks.find(ptr);
+            if (it == live.blocks.end())
+            {
+                SB_LOG_WARN("Pointer {} was not allocated by this caching allocator.", ptr);
+                return;
+            }
+            block = it->second;
+            live.blocks.erase(it);
+        }
+
+        in_use_.fetch_sub(block.bytes, std::memory_order_relaxed);
+
+        if (!block.cached)
+        {
+            upstream_->deallocate(ptr);
+            reserved_.fetch_sub(block.bytes, std::memory_order_relaxed);
+            return;
+        }
+
+        Fence fence = current_fence();
+        if (block.page)
+        {
+            if (fence_done(fence))
+            {
+                pool_.deallocate_to_page(*block.page, ptr);
+                return;
+            }
+
+            SlabList& list = slab_list(block.bytes, block.strategy);
+            std::lock_guard<std::mutex> lock(list.mutex);
+            list.pending.push_back({ptr, block.bytes, std::move(fence), block.page});
+            return;
+        }
+
+        Shard& shard = own_shard();
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.free[free_key(block.bytes, block.strategy)].push_back({ptr, block.bytes, std::move(fence), nullptr});
+    }
+
+    sycl::device CachingAllocator::get_device_of(void* ptr)
+    {
+        return upstream_->get_device_of(ptr);
+    }
+
+    size_t CachingAllocator::trim()
+    {
+        size_t freed = 0;
+        for (Shard& shard : shards_)
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            for (auto& [key, list] : shard.free)
+            {
+                for (size_t i = list.size(); i-- > 0;)
+                {
+                    if (!fence_done(list[i].fence)) continue;
+
+                    upstream_->deallocate(list[i].ptr);
+                    freed += list[i].bytes;
+                    list[i] = std::move(list.back());
+                    list.pop_back();
+                }
+            }
+        }
+        reserved_.fetch_sub(freed, std::memory_order_relaxed);
+
+        for (SlabList& list : slabs_)
+        {
+            std::lock_guard<std::mutex> lock(list.mutex);
+            release_pending(list);
+        }
+
+        if (freed > 0) SB_LOG_INFO("Caching allocator returned {} bytes.", freed);
+        return freed;
+    }
+
+    MemoryStats CachingAllocator::stats() const
+    {
+        MemoryStats s;
+        s.in_use_bytes = in_use_.load(std::memory_order_relaxed);
+        s.peak_bytes = peak_.load(std::memory_order_relaxed);
+        s.reserved_bytes = reserved_.load(std::memory_order_relaxed);
+        s.cached_bytes = s.reserved_bytes > s.in_use_bytes ? s.reserved_bytes - s.in_use_bytes : 0;
+        s.hits = hits_.load(std::memory_order_relaxed);
+        s.misses = misses_.load(std::memory_order_relaxed);
+        return s;
+    }
+
+    void CachingAllocator::reset_peak()
+    {
+        peak_.store(in_use_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+} // namespace SushiBLAS
@@ -50,15 +50,15 @@ namespace SushiBLAS
 
         // TODO: Implement multi-dimensional batch support
 
-        void* read_x = x.storage ? x.storage->data_ptr : nullptr;
-        void* write_y = y.storage ? y.storage->data_ptr : nullptr;
+        void* read_x = x.storage ? x.data() : nullptr;
+        void* write_y = y.storage ? y.data() : nullptr;
 
-        std::vector<void*> reads = {};
-        if (read_x) reads.push_back(read_x);
-        std::vector<void*> writes = {};
-        if (write_y) writes.push_back(write_y);
+        std::vector<AccessRange> reads = {};
+        if (read_x) reads.push_back(x.access_range());
+        std::vector<AccessRange> writes = {};
+        if (write_y) writes.push_back(y.access_range());
 
-        return Internal::execute_level1(engine_, "blas.lvl1.copy", "blas.lvl1.copy"_op, x.dtype, reads, writes, {},
+        return Internal::execute_level1(engine_, "blas.lvl1.copy", "blas.lvl1.copy"_op, x.dtype, reads, writes, {}, Internal::vector_cost(n, x.dtype, 0, 2),
             [n, incx, incy, pX=read_x, pY=write_y](auto scalar_type, sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event
             {
                 using T = decltype(scalar_type);
@@ -53,17 +53,17 @@ namespace SushiBLAS
 
         // TODO: Implement multi-dimensional batch support for Level 1 DOT
 
-        void* read_x = x.storage ? x.storage->data_ptr : nullptr;
-        void* read_y = y.storage ? y.storage->data_ptr : nullptr;
-        void* write_r = result.storage ? result.storage->data_ptr : nullptr;
+        void* read_x = x.storage ? x.data() : nullptr;
+        void* read_y = y.storage ? y.data() : nullptr;
+        void* write_r = result.storage ? result.data() : nullptr;
 
-        std::vector<void*> reads = {};
-        if (read_x) reads.push_back(read_x);
-        if (read_y) reads.push_back(read_y);
-        std::vector<void*> writes = {};
-        if (write_r) writes.push_back(write_r);
+        std::vector<AccessRange> reads = {};
+        if (read_x) reads.push_back(x.access_range());
+        if (read_y) reads.push_back(y.access_range());
+        std::vector<AccessRange> writes = {};
+        if (write_r) writes.push_back(result.access_range());
 
-        return Internal::execute_level1(engine_, "blas.lvl1.dot", "blas.lvl1.dot"_op, x.dtype, reads, writes, {},
+        return Internal::execute_level1(engine_, "blas.lvl1.dot", "blas.lvl1.dot"_op, x.dtype, reads, writes, {}, Internal::vector_cost(n, x.dtype, 2, 2),
             [n, incx, incy, pX=read_x, pY=read_y, pR=write_r](auto scalar_type, sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event
             {
                 using T = decltype(scalar_type);
@@ -47,11 +47,24 @@ namespace SushiBLAS
         template<typename T> struct is_complex<std::complex<T>> : std::true_type {};
         template<typename T> inline constexpr bool is_complex_v = is_complex<T>::value;
 
+        /**
+         * @brief Work of a level 1 operation on n elements.
+         * @param n Number of elements per vector.
+         * @param dtype Element type.
+         * @param flops_per_element Floating point operations per element.
+         * @param accesses_per_element Element reads plus writes per element, over all vectors.
+         */
+        inline OpCost vector_cost(int64_t n, Core::DataType dtype, uint64_t flops_per_element, uint64_t accesses_per_element)
+        {
+            uint64_t count = static_cast<uint64_t>(n);
+            return {count * flops_per_element, count * accesses_per_element * Core::element_size(dtype)};
+        }
+
         /**
          * @brief Internal helper to execute a generically dispatched MKL level 1 BLAS task.
          */
         template<typename Func>
-        sycl::event execute_level1(Engine& engine, const char* name, SushiRuntime::Graph::OpID op_id, Core::DataType dtype, const std::vector<void*>& reads, const std::vector<void*>& writes, const std::vector<float>& params, Func&& op_func)
+        sycl::event execute_level1(Engine& engine, const char* name, SushiRuntime::Graph::OpID op_id, Core::DataType dtype, const std::vector<AccessRange>& reads, const std::vector<AccessRange>& writes, const std::vector<float>& params, const OpCost& cost, Func&& op_func)
         {
             SushiRuntime::Graph::TaskMetadata meta;
             meta.name = name;
@@ -59,7 +72,7 @@ namespace SushiBLAS
             meta.op_id = op_id;
             for (size_t i = 0; i < params.size(); ++i) meta.set_param(i, params[i]);
 
-            engine.get_graph().add_task(meta, reads, writes,
+            engine.add_task(meta, reads, writes,
                 [dtype, op_func, name](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
                 {
                     SB_LOG_INFO("MKL Level 1 {}: starting", name);
@@ -80,7 +93,7 @@ namespace SushiBLAS
                             break;
                     }
                     return sycl::event();
-                });
+                }, {}, cost);
             return sycl::event();
         }
 
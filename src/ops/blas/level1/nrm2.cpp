@@ -45,15 +45,15 @@ namespace SushiBLAS
         int64_t n, incx;
         Internal::get_vec_params(x, n, incx);
 
-        void* read_x = x.storage ? x.storage->data_ptr : nullptr;
-        void* write_r = result.storage ? result.storage->data_ptr : nullptr;
+        void* read_x = x.storage ? x.data() : nullptr;
+        void* write_r = result.storage ? result.data() : nullptr;
 
-        std::vector<void*> reads = {};
-        if (read_x) reads.push_back(read_x);
-        std::vector<void*> writes = {};
-        if (write_r) writes.push_back(write_r);
+        std::vector<AccessRange> reads = {};
+        if (read_x) reads.push_back(x.access_range());
+        std::vector<AccessRange> writes = {};
+        if (write_r) writes.push_back(result.access_range());
 
-        return Internal::execute_level1(engine_, "blas.lvl1.nrm2", "blas.lvl1.nrm2"_op, x.dtype, reads, writes, {},
+        return Internal::execute_level1(engine_, "blas.lvl1.nrm2", "blas.lvl1.nrm2"_op, x.dtype, reads, writes, {}, Internal::vector_cost(n, x.dtype, 2, 1),
             [n, incx, pX=read_x, pR=write_r](auto scalar_type, sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event
             {
                 using T = decltype(scalar_type);
@@ -50,15 +50,15 @@ namespace SushiBLAS
 
         // TODO: Implement multi-dimensional batch support
 
-        void* write_x = x.storage ? x.storage->data_ptr : nullptr;
-        void* write_y = y.storage ? y.storage->data_ptr : nullptr;
+        void* write_x = x.storage ? x.data() : nullptr;
+        void* write_y = y.storage ? y.data() : nullptr;
 
-        std::vector<void*> reads = {}; // x and y are updated
-        std::vector<void*> writes = {};
-        if (write_x) writes.push_back(write_x);
-        if (write_y) writes.push_back(write_y);
+        std::vector<AccessRange> reads = {}; // x and y are updated
+        std::vector<AccessRange> writes = {};
+        if (write_x) writes.push_back(x.access_range());
+        if (write_y) writes.push_back(y.access_range());
 
-        return Internal::execute_level1(engine_, "blas.lvl1.rot", "blas.lvl1.rot"_op, x.dtype, reads, writes, {c, s},
+        return Internal::execute_level1(engine_, "blas.lvl1.rot", "blas.lvl1.rot"_op, x.dtype, reads, writes, {c, s}, Internal::vector_cost(n, x.dtype, 6, 4),
             [n, c, s, incx, incy, pX=write_x, pY=write_y](auto scalar_type, sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event
             {
                 using T = decltype(scalar_type);
@@ -47,13 +47,13 @@ namespace SushiBLAS
 
         // TODO: Implement multi-dimensional batch support
 
-        void* write_x = x.storage ? x.storage->data_ptr : nullptr;
+        void* write_x = x.storage ? x.data() : nullptr;
 
-        std::vector<void*> reads = {};
-        std::vector<void*> writes = {};
-        if (write_x) writes.push_back(write_x);
+        std::vector<AccessRange> reads = {};
+        std::vector<AccessRange> writes = {};
+        if (write_x) writes.push_back(x.access_range());
 
-        return Internal::execute_level1(engine_, "blas.lvl1.scal", "blas.lvl1.scal"_op, x.dtype, reads, writes, {alpha},
+        return Internal::execute_level1(engine_, "blas.lvl1.scal", "blas.lvl1.scal"_op, x.dtype, reads, writes, {alpha}, Internal::vector_cost(n, x.dtype, 1, 2),
             [n, alpha, incx, pX=write_x](auto scalar_type, sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event
             {
                 using T = decltype(scalar_type);
@@ -50,15 +50,15 @@ namespace SushiBLAS
 
         // TODO: Implement multi-dimensional batch support
 
-        void* write_x = x.storage ? x.storage->data_ptr : nullptr;
-        void* write_y = y.storage ? y.storage->data_ptr : nullptr;
+        void* write_x = x.storage ? x.data() : nullptr;
+        void* write_y = y.storage ? y.data() : nullptr;
 
-        std::vector<void*> reads = {};
-        std::vector<void*> writes = {};
-        if (write_x) writes.push_back(write_x);
-        if (write_y) writes.push_back(write_y);
+        std::vector<AccessRange> reads = {};
+        std::vector<AccessRange> writes = {};
+        if (write_x) writes.push_back(x.access_range());
+        if (write_y) writes.push_back(y.access_range());
 
-        return Internal::execute_level1(engine_, "blas.lvl1.swap", "blas.lvl1.swap"_op, x.dtype, reads, writes, {},
+        return Internal::execute_level1(engine_, "blas.lvl1.swap", "blas.lvl1.swap"_op, x.dtype, reads, writes, {}, Internal::vector_cost(n, x.dtype, 0, 4),
             [n, incx, incy, pX=write_x, pY=write_y](auto scalar_type, sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event
             {
                 using T = decltype(scalar_type);
@@ -90,15 +90,15 @@ namespace SushiBLAS
 
         auto mkl_transA = transA ? oneapi::mkl::transpose::trans : oneapi::mkl::transpose::nontrans;
 
-        void* read_A = A.storage ? A.storage->data_ptr : nullptr;
-        void* read_x = x.storage ? x.storage->data_ptr : nullptr;
-        void* write_y = y.storage ? y.storage->data_ptr : nullptr;
+        void* read_A = A.storage ? A.data() : nullptr;
+        void* read_x = x.storage ? x.data() : nullptr;
+        void* write_y = y.storage ? y.data() : nullptr;
 
-        std::vector<void*> reads = {};
-        if (read_A) reads.push_back(read_A);
-        if (read_x) reads.push_back(read_x);
-        std::vector<void*> writes = {};
-        if (write_y) writes.push_back(write_y);
+        std::vector<AccessRange> reads = {};
+        if (read_A) reads.push_back(A.access_range());
+        if (read_x) reads.push_back(x.access_range());
+        std::vector<AccessRange> writes = {};
+        if (write_y) writes.push_back(y.access_range());
 
         SushiRuntime::Graph::TaskMetadata meta;
         meta.name = "blas.lvl2.gemv";
@@ -110,36 +110,40 @@ namespace SushiBLAS
 
         auto layout = A.layout;
 
+        // 2*m*n flops, one pass over A and x, y read and written
+        uint64_t um = static_cast<uint64_t>(m), un = static_cast<uint64_t>(n);
+        OpCost cost{2 * um * un, (um * un + um + 2 * un) * Core::element_size(A.dtype)};
+
         switch (A.dtype) 
         {
             // TODO: Add support for Core::DataType::HALF
             case Core::DataType::FLOAT32:
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, mkl_transA, m, n, alpha, lda, incx, beta, incy, pA=A.data_as<float>(), px=x.data_as<float>(), py=y.data_as<float>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event {
                         return gemv_dispatch<float>(q, layout, mkl_transA, m, n, alpha, pA, lda, px, incx, beta, py, incy, deps);
-                    });
+                    }, {}, cost);
                 break;
             case Core::DataType::FLOAT64:
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, mkl_transA, m, n, alpha_d=static_cast<double>(alpha), lda, incx, beta_d=static_cast<double>(beta), incy, pA=A.data_as<double>(), px=x.data_as<double>(), py=y.data_as<double>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event {
                         return gemv_dispatch<double>(q, layout, mkl_transA, m, n, alpha_d, pA, lda, px, incx, beta_d, py, incy, deps);
-                    });
+                    }, {}, cost);
                 break;
             case Core::DataType::COMPLEX32:
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, mkl_transA, m, n, alpha_c=std::complex<float>(alpha, 0.0f), lda, incx, beta_c=std::complex<float>(beta, 0.0f), incy, pA=A.data_as<std::complex<float>>(), px=x.data_as<std::complex<float>>(), py=y.data_as<std::complex<float>>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event {
                         return gemv_dispatch<std::complex<float>>(q, layout, mkl_transA, m, n, alpha_c, pA, lda, px, incx, beta_c, py, incy, deps);
-                    });
+                    }, {}, cost);
                 break;
             case Core::DataType::COMPLEX64:
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, mkl_transA, m, n, alpha_c=std::complex<double>(alpha, 0.0), lda, incx, beta_c=std::complex<double>(beta, 0.0), incy, pA=A.data_as<std::complex<double>>(), px=x.data_as<std::complex<double>>(), py=y.data_as<std::complex<double>>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event {
                         return gemv_dispatch<std::complex<double>>(q, layout, mkl_transA, m, n, alpha_c, pA, lda, px, incx, beta_c, py, incy, deps);
-                    });
+                    }, {}, cost);
                 break;
             default:
                 SB_THROW_IF(true, "Unsupported data type for GEMV.");
@@ -107,15 +107,15 @@ namespace SushiBLAS
         SB_THROW_IF(nx != m, "Dimension mismatch for vector x in GER.");
         SB_THROW_IF(ny != n, "Dimension mismatch for vector y in GER.");
 
-        void* read_x = x.storage ? x.storage->data_ptr : nullptr;
-        void* read_y = y.storage ? y.storage->data_ptr : nullptr;
-        void* write_A = A.storage ? A.storage->data_ptr : nullptr;
+        void* read_x = x.storage ? x.data() : nullptr;
+        void* read_y = y.storage ? y.data() : nullptr;
+        void* write_A = A.storage ? A.data() : nullptr;
 
-        std::vector<void*> reads = {};
-        if (read_x) reads.push_back(read_x);
-        if (read_y) reads.push_back(read_y);
-        std::vector<void*> writes = {};
-        if (write_A) writes.push_back(write_A);
+        std::vector<AccessRange> reads = {};
+        if (read_x) reads.push_back(x.access_range());
+        if (read_y) reads.push_back(y.access_range());
+        std::vector<AccessRange> writes = {};
+        if (write_A) writes.push_back(A.access_range());
 
         SushiRuntime::Graph::TaskMetadata meta;
         meta.name = "blas.lvl2.ger";
@@ -131,28 +131,28 @@ namespace SushiBLAS
         {
             // TODO: Add support for Core::DataType::HALF
             case Core::DataType::FLOAT32:
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, m, n, alpha, incx, incy, lda, px=x.data_as<float>(), py=y.data_as<float>(), pA=A.data_as<float>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event {
                         return ger_dispatch<float>(q, layout, m, n, alpha, px, incx, py, incy, pA, lda, deps);
                     });
                 break;
             case Core::DataType::FLOAT64:
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, m, n, alpha_d=static_cast<double>(alpha), incx, incy, lda, px=x.data_as<double>(), py=y.data_as<double>(), pA=A.data_as<double>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event {
                         return ger_dispatch<double>(q, layout, m, n, alpha_d, px, incx, py, incy, pA, lda, deps);
                     });
                 break;
             case Core::DataType::COMPLEX32:
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, m, n, alpha_c=std::complex<float>(alpha, 0.0f), incx, incy, lda, px=x.data_as<std::complex<float>>(), py=y.data_as<std::complex<float>>(), pA=A.data_as<std::complex<float>>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event {
                         return ger_dispatch<std::complex<float>>(q, layout, m, n, alpha_c, px, incx, py, incy, pA, lda, deps);
                     });
                 break;
             case Core::DataType::COMPLEX64:
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, m, n, alpha_c=std::complex<double>(alpha, 0.0), incx, incy, lda, px=x.data_as<std::complex<double>>(), py=y.data_as<std::complex<double>>(), pA=A.data_as<std::complex<double>>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event {
                         return ger_dispatch<std::complex<double>>(q, layout, m, n, alpha_c, px, incx, py, incy, pA, lda, deps);
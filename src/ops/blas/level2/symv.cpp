@@ -85,15 +85,15 @@ namespace SushiBLAS
         auto mkl_uplo = upper ? oneapi::mkl::uplo::upper : oneapi::mkl::uplo::lower;
         auto layout = A.layout;
 
-        void* read_A = A.storage ? A.storage->data_ptr : nullptr;
-        void* read_x = x.storage ? x.storage->data_ptr : nullptr;
-        void* write_y = y.storage ? y.storage->data_ptr : nullptr;
+        void* read_A = A.storage ? A.data() : nullptr;
+        void* read_x = x.storage ? x.data() : nullptr;
+        void* write_y = y.storage ? y.data() : nullptr;
 
-        std::vector<void*> reads = {};
-        if (read_A) reads.push_back(read_A);
-        if (read_x) reads.push_back(read_x);
-        std::vector<void*> writes = {};
-        if (write_y) writes.push_back(write_y);
+        std::vector<AccessRange> reads = {};
+        if (read_A) reads.push_back(A.access_range());
+        if (read_x) reads.push_back(x.access_range());
+        std::vector<AccessRange> writes = {};
+        if (write_y) writes.push_back(y.access_range());
 
         SushiRuntime::Graph::TaskMetadata meta;
         meta.name = "blas.lvl2.symv";
@@ -109,28 +109,28 @@ namespace SushiBLAS
         {
             // TODO: Add support for Core::DataType::HALF
             case Core::DataType::FLOAT32:
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, mkl_uplo, n, alpha, lda, incx, beta, incy, pA=A.data_as<float>(), px=x.data_as<float>(), py=y.data_as<float>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event {
                         return symv_dispatch<float>(q, layout, mkl_uplo, n, alpha, pA, lda, px, incx, beta, py, incy, deps);
                     });
                 break;
             case Core::DataType::FLOAT64:
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, mkl_uplo, n, alpha_d=static_cast<double>(alpha), lda, incx, beta_d=static_cast<double>(beta), incy, pA=A.data_as<double>(), px=x.data_as<double>(), py=y.data_as<double>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event {
                         return symv_dispatch<double>(q, layout, mkl_uplo, n, alpha_d, pA, lda, px, incx, beta_d, py, incy, deps);
                     });
                 break;
             case Core::DataType::COMPLEX32:
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, mkl_uplo, n, alpha_c=std::complex<float>(alpha, 0.0f), lda, incx, beta_c=std::complex<float>(beta, 0.0f), incy, pA=A.data_as<std::complex<float>>(), px=x.data_as<std::complex<float>>(), py=y.data_as<std::complex<float>>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event {
                         return symv_dispatch<std::complex<float>>(q, layout, mkl_uplo, n, alpha_c, pA, lda, px, incx, beta_c, py, incy, deps);
                     });
                 break;
             case Core::DataType::COMPLEX64:
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, mkl_uplo, n, alpha_c=std::complex<double>(alpha, 0.0), lda, incx, beta_c=std::complex<double>(beta, 0.0), incy, pA=A.data_as<std::complex<double>>(), px=x.data_as<std::complex<double>>(), py=y.data_as<std::complex<double>>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event {
                         return symv_dispatch<std::complex<double>>(q, layout, mkl_uplo, n, alpha_c, pA, lda, px, incx, beta_c, py, incy, deps);
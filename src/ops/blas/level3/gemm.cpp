@@ -32,6 +32,7 @@
 #include <complex>
 #include <oneapi/mkl.hpp>
 #include <SushiBLAS/engine.hpp>
+#include <SushiBLAS/graph/profiler.hpp>
 #include <SushiBLAS/ops/blas/level3.hpp>
 #include <SushiRuntime/graph/task_types.hpp>
 
@@ -77,47 +78,164 @@ namespace SushiBLAS
                 }
             }
         }
-    } // namespace Anonymous
 
-    sycl::event Level3::gemm(const Tensor& A, const Tensor& B, Tensor& C, 
-                            bool transA, bool transB,
-                            float alpha, float beta) 
-    {
-        // 1. Validation
-        SB_THROW_IF(A.rank < 2 || B.rank < 2 || C.rank < 2, "GEMM requires at least 2D tensors.");
-        SB_THROW_IF(A.dtype != B.dtype || A.dtype != C.dtype, "Data type mismatch in GEMM operation.");
+        /** @brief Sizes, leading dimensions and batch strides of one GEMM call. */
+        struct GemmShape 
+        {
+            int64_t m, n, k;
+            int64_t lda, ldb, ldc;
+            int64_t str_a, str_b, str_c;
+            int64_t batch_size;
+            oneapi::mkl::transpose transA, transB;
+            Core::Layout layout;
+        };
+
+        GemmShape make_gemm_shape(const Tensor& A, const Tensor& B, const Tensor& C, bool transA, bool transB)
+        {
+            SB_THROW_IF(A.rank < 2 || B.rank < 2 || C.rank < 2, "GEMM requires at least 2D tensors.");
+            SB_THROW_IF(A.dtype != B.dtype || A.dtype != C.dtype, "Data type mismatch in GEMM operation.");
+
+            GemmShape s;
+            int32_t rA = A.rank, rB = B.rank, rC = C.rank;
+            s.m = C.shape[rC - 2];
+            s.n = C.shape[rC - 1];
+            s.k = transA ? A.shape[rA - 2] : A.shape[rA - 1];
+
+            // Batch & Stride calculation
+            s.batch_size = 1;
+            for (int i = 0; i < rC - 2; ++i) s.batch_size *= C.shape[i];
+
+            s.lda = (A.layout == Core::Layout::ROW_MAJOR) ? A.shape[rA - 1] : A.shape[rA - 2];
+            s.ldb = (B.layout == Core::Layout::ROW_MAJOR) ? B.shape[rB - 1] : B.shape[rB - 2];
+            s.ldc = (C.layout == Core::Layout::ROW_MAJOR) ? C.shape[rC - 1] : C.shape[rC - 2];
+
+            s.str_a = (s.batch_size > 1) ? A.strides[rA - 3] : 0;
+            s.str_b = (s.batch_size > 1) ? B.strides[rB - 3] : 0;
+            s.str_c = (s.batch_size > 1) ? C.strides[rC - 3] : 0;
+
+            s.transA = transA ? oneapi::mkl::transpose::trans : oneapi::mkl::transpose::nontrans;
+            s.transB = transB ? oneapi::mkl::transpose::trans : oneapi::mkl::transpose::nontrans;
+            s.layout = A.layout;
+            return s;
+        }
+
+        /** @brief Work of one GEMM call: 2*m*n*k flops per batch and one pass over A, B and C (C twice if beta is used). */
+        OpCost gemm_cost(const GemmShape& s, Core::DataType dtype, float beta)
+        {
+            uint64_t batch = static_cast<uint64_t>(s.batch_size);
+            uint64_t m = static_cast<uint64_t>(s.m), n = static_cast<uint64_t>(s.n), k = static_cast<uint64_t>(s.k);
+            uint64_t c_passes = beta != 0.0f ? 2 : 1;
+            return {2 * m * n * k * batch, (m * k + k * n + c_passes * m * n) * batch * Core::element_size(dtype)};
+        }
+
+        template<typename T>
+        inline T apply_activation(Core::Activation act, T x, T slope)
+        {
+            switch (act)
+            {
+                case Core::Activation::RELU: return x > T(0) ? x : T(0);
+                case Core::Activation::LEAKY_RELU: return x > T(0) ? x : x * slope;
+                case Core::Activation::GELU:
+                {
+                    T inner = T(0.7978845608028654) * (x + T(0.044715) * x * x * x);
+                    return T(0.5) * x * (T(1) + sycl::tanh(inner));
+                }
+                case Core::Activation::SILU: return x / (T(1) + sycl::exp(-x));
+                case Core::Activation::SIGMOID: return T(1) / (T(1) + sycl::exp(-x));
+                case Core::Activation::TANH: return sycl::tanh(x);
+                default: return x;
+            }
+        }
+
+        /**
+         * @brief Run the GEMM and then one pass over C for scale, bias and activation.
+         * 
+         * oneMKL does not take a device callback, so the epilogue cannot run inside 
+         * the GEMM kernel. It runs right after it, in the same task, and reads C only once.
+         */
+        template<typename T>
+        sycl::event gemm_epilogue_dispatch(sycl::queue& queue, const GemmShape& s, T alpha, T beta,
+                                           const T* a, const T* b, T* c, const T* bias, const T* scale,
+                                           Core::Activation act, T slope,
+                                           const std::vector<sycl::event>& deps)
+        {
+            sycl::event gemm_done = gemm_dispatch<T>(queue, s.layout, s.transA, s.transB, s.m, s.n, s.k, 
+                                                     alpha, a, s.lda, s.str_a, b, s.ldb, s.str_b, 
+                                                     beta, c, s.ldc, s.str_c, s.batch_size, deps);
 
-        int32_t rA = A.rank, rB = B.rank, rC = C.rank;
-        int64_t m = C.shape[rC - 2];
-        int64_t n = C.shape[rC - 1];
-        int64_t k = transA ? A.shape[rA - 2] : A.shape[rA - 1];
+            if (bias == nullptr && scale == nullptr && act == Core::Activation::NONE)
+                return gemm_done;
 
-        // Batch & Stride calculation
-        int64_t batch_size = 1;
-        for (int i = 0; i < rC - 2; ++i) batch_size *= C.shape[i];
+            // the task ends with the epilogue, but its time starts with the GEMM
+            mark_first_kernel(gemm_done);
 
-        int64_t lda = (A.layout == Core::Layout::ROW_MAJOR) ? A.shape[rA - 1] : A.shape[rA - 2];
-        int64_t ldb = (B.layout == Core::Layout::ROW_MAJOR) ? B.shape[rB - 1] : B.shape[rB - 2];
-        int64_t ldc = (C.layout == Core::Layout::ROW_MAJOR) ? C.shape[rC - 1] : C.shape[rC - 2];
+            SB_LOG_INFO("GEMM epilogue: {}x[{}x{}]", s.batch_size, s.m, s.n);
+            return queue.submit([&](sycl::handler& h) 
+            {
+                h.depends_on(gemm_done);
+                h.parallel_for(sycl::range<1>(s.batch_size * s.m * s.n), 
+                    [=, m = s.m, n = s.n, ldc = s.ldc, str_c = s.str_c, row_major = s.layout == Core::Layout::ROW_MAJOR](sycl::id<1> idx) 
+                    {
+                        int64_t j = idx[0] % n;
+                        int64_t i = (idx[0] / n) % m;
+                        int64_t batch = idx[0] / (m * n);
+                        int64_t off = batch * str_c + (row_major ? i * ldc + j : j * ldc + i);
+
+                        T v = c[off];
+                        if (scale) v = v * scale[j];
+                        if (bias) v = v + bias[j];
+                        c[off] = apply_activation(act, v, slope);
+                    });
+            });
+        }
 
-        int64_t str_a = (batch_size > 1) ? A.strides[rA - 3] : 0;
-        int64_t str_b = (batch_size > 1) ? B.strides[rB - 3] : 0;
-        int64_t str_c = (batch_size > 1) ? C.strides[rC - 3] : 0;
+        template<typename T>
+        void add_gemm_epilogue_task(Engine& engine, const SushiRuntime::Graph::TaskMetadata& meta,
+                                    const std::vector<AccessRange>& reads, const std::vector<AccessRange>& writes,
+                                    const GemmShape& s, float alpha, float beta,
+                                    const Tensor& A, const Tensor& B, Tensor& C, const GemmEpilogue& epilogue)
+        {
+            // the epilogue adds a few flops and one pass over the bias and scale vectors per element of C
+            OpCost cost = gemm_cost(s, C.dtype, beta);
+            cost.flops += 3 * static_cast<uint64_t>(s.batch_size * s.m * s.n);
+            cost.bytes += ((epilogue.bias ? 1 : 0) + (epilogue.scale ? 1 : 0)) * s.n * Core::element_size(C.dtype);
+
+            engine.add_task(meta, reads, writes,
+                [s, alpha = static_cast<T>(alpha), beta = static_cast<T>(beta), 
+                 act = epilogue.activation, slope = static_cast<T>(epilogue.activation_alpha),
+                 pA = A.data_as<T>(), pB = B.data_as<T>(), pC = C.data_as<T>(),
+                 pBias = epilogue.bias ? epilogue.bias->data_as<T>() : nullptr,
+                 pScale = epilogue.scale ? epilogue.scale->data_as<T>() : nullptr]
+                (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
+                {
+                    return gemm_epilogue_dispatch<T>(q, s, alpha, beta, pA, pB, pC, pBias, pScale, act, slope, deps);
+                }, {}, cost);
+        }
+    } // namespace Anonymous
 
-        auto mkl_transA = transA ? oneapi::mkl::transpose::trans : oneapi::mkl::transpose::nontrans;
-        auto mkl_transB = transB ? oneapi::mkl::transpose::trans : oneapi::mkl::transpose::nontrans;
+    sycl::event Level3::gemm(const Tensor& A, const Tensor& B, Tensor& C, 
+                            bool transA, bool transB,
+                            float alpha, float beta) 
+    {
+        GemmShape s = make_gemm_shape(A, B, C, transA, transB);
+        int64_t m = s.m, n = s.n, k = s.k;
+        int64_t lda = s.lda, ldb = s.ldb, ldc = s.ldc;
+        int64_t str_a = s.str_a, str_b = s.str_b, str_c = s.str_c;
+        int64_t batch_size = s.batch_size;
+        auto mkl_transA = s.transA;
+        auto mkl_transB = s.transB;
 
         // Capture data safely for asynchronous execution
-        auto layout = A.layout;
-        void* read_A = A.storage ? A.storage->data_ptr : nullptr;
-        void* read_B = B.storage ? B.storage->data_ptr : nullptr;
-        void* write_C = C.storage ? C.storage->data_ptr : nullptr;
+        auto layout = s.layout;
+        void* read_A = A.storage ? A.data() : nullptr;
+        void* read_B = B.storage ? B.data() : nullptr;
+        void* write_C = C.storage ? C.data() : nullptr;
 
-        std::vector<void*> reads = {};
-        if (read_A) reads.push_back(read_A);
-        if (read_B) reads.push_back(read_B);
-        std::vector<void*> writes = {};
-        if (write_C) writes.push_back(write_C);
+        std::vector<AccessRange> reads = {};
+        if (read_A) reads.push_back(A.access_range());
+        if (read_B) reads.push_back(B.access_range());
+        std::vector<AccessRange> writes = {};
+        if (write_C) writes.push_back(C.access_range());
 
         SushiRuntime::Graph::TaskMetadata meta;
         meta.name = "blas.lvl3.gemm";
@@ -129,66 +247,63 @@ namespace SushiBLAS
         meta.set_param(2, transA);
         meta.set_param(3, transB);
 
+        OpCost cost = gemm_cost(s, A.dtype, beta);
+
         switch (A.dtype)
         {
             case Core::DataType::HALF:
             {
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, mkl_transA, mkl_transB, m, n, k, alpha, lda, str_a, ldb, str_b, beta, ldc, str_c, batch_size, 
                      pA=A.data_as<sycl::half>(), pB=B.data_as<sycl::half>(), pC=C.data_as<sycl::half>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
                     {
                         return gemm_dispatch<sycl::half>(q, layout, mkl_transA, mkl_transB, m, n, k, static_cast<sycl::half>(alpha), pA, lda, str_a, pB, ldb, str_b, static_cast<sycl::half>(beta), pC, ldc, str_c, batch_size, deps);
-                    }
-                );
+                    }, {}, cost);
                 break;
             }
             case Core::DataType::FLOAT32:
             {
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, mkl_transA, mkl_transB, m, n, k, alpha, lda, str_a, ldb, str_b, beta, ldc, str_c, batch_size, 
                      pA=A.data_as<float>(), pB=B.data_as<float>(), pC=C.data_as<float>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
                     {
                         return gemm_dispatch<float>(q, layout, mkl_transA, mkl_transB, m, n, k, alpha, pA, lda, str_a, pB, ldb, str_b, beta, pC, ldc, str_c, batch_size, deps);
-                    }
-                );
+                    }, {}, cost);
                 break;
             }
             case Core::DataType::FLOAT64:
             {
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, mkl_transA, mkl_transB, m, n, k, alpha_d=static_cast<double>(alpha), lda, str_a, ldb, str_b, beta_d=static_cast<double>(beta), ldc, str_c, batch_size, 
                      pA=A.data_as<double>(), pB=B.data_as<double>(), pC=C.data_as<double>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
                     {
                         return gemm_dispatch<double>(q, layout, mkl_transA, mkl_transB, m, n, k, alpha_d, pA, lda, str_a, pB, ldb, str_b, beta_d, pC, ldc, str_c, batch_size, deps);
-                    }
-                );
+                    }, {}, cost);
                 break;
             }
             case Core::DataType::COMPLEX32:
             {
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, mkl_transA, mkl_transB, m, n, k, alpha_c=std::complex<float>(alpha, 0.0f), lda, str_a, ldb, str_b, beta_c=std::complex<float>(beta, 0.0f), ldc, str_c, batch_size, 
                      pA=A.data_as<std::complex<float>>(), pB=B.data_as<std::complex<float>>(), pC=C.data_as<std::complex<float>>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
                     {
                         return gemm_dispatch<std::complex<float>>(q, layout, mkl_transA, mkl_transB, m, n, k, alpha_c, pA, lda, str_a, pB, ldb, str_b, beta_c, pC, ldc, str_c, batch_size, deps);
-                    }
-                );
+                    }, {}, cost);
                 break;
             }
             case Core::DataType::COMPLEX64:
             {
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, mkl_transA, mkl_transB, m, n, k, alpha_c=std::complex<double>(alpha, 0.0), lda, str_a, ldb, str_b, beta_c=std::complex<double>(beta, 0.0), ldc, str_c, batch_size, 
                      pA=A.data_as<std::complex<double>>(), pB=B.data_as<std::complex<double>>(), pC=C.data_as<std::complex<double>>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
                     {
                         return gemm_dispatch<std::complex<double>>(q, layout, mkl_transA, mkl_transB, m, n, k, alpha_c, pA, lda, str_a, pB, ldb, str_b, beta_c, pC, ldc, str_c, batch_size, deps);
-                    }
-                );
+                    }, {}, cost);
                 break;
             }
             default:
@@ -196,4 +311,56 @@ namespace SushiBLAS
         }
         return sycl::event(); 
     }
+
+    sycl::event Level3::gemm(const Tensor& A, const Tensor& B, Tensor& C, 
+                            const GemmEpilogue& epilogue,
+                            bool transA, bool transB,
+                            float alpha, float beta) 
+    {
+        GemmShape s = make_gemm_shape(A, B, C, transA, transB);
+
+        for (const Tensor* v : {epilogue.bias, epilogue.scale})
+        {
+            if (v == nullptr) continue;
+            SB_THROW_IF(v->num_elements != s.n, "GEMM epilogue vectors must have N = {} elements, got {}.", s.n, v->num_elements);
+            SB_THROW_IF(v->dtype != C.dtype, "Data type mismatch in GEMM epilogue.");
+            SB_THROW_IF(!v->is_contiguous(), "GEMM epilogue vectors must be contiguous, the kernel reads them as dense arrays.");
+            SB_THROW_IF(!v->storage || v->storage->data_ptr == nullptr, "GEMM epilogue vector has no data.");
+        }
+
+        std::vector<AccessRange> reads = {};
+        for (const Tensor* t : {&A, &B, epilogue.bias, epilogue.scale})
+            if (t && t->storage && t->storage->data_ptr) reads.push_back(t->access_range());
+        std::vector<AccessRange> writes = {};
+        if (C.storage && C.storage->data_ptr) writes.push_back(C.access_range());
+
+        SushiRuntime::Graph::TaskMetadata meta;
+        meta.name = "blas.lvl3.gemm_epilogue";
+        meta.task_type = SushiRuntime::Graph::TaskType::MATH_OP;
+        meta.op_id = "blas.lvl3.gemm_epilogue"_op;
+        meta.set_param(0, alpha);
+        meta.set_param(1, beta);
+        meta.set_param(2, transA);
+        meta.set_param(3, transB);
+        meta.set_param(4, static_cast<uint8_t>(epilogue.activation));
+        meta.set_param(5, epilogue.activation_alpha);
+        meta.set_param(6, epilogue.bias != nullptr);
+        meta.set_param(7, epilogue.scale != nullptr);
+
+        switch (A.dtype)
+        {
+            case Core::DataType::HALF:
+                add_gemm_epilogue_task<sycl::half>(engine_, meta, reads, writes, s, alpha, beta, A, B, C, epilogue);
+                break;
+            case Core::DataType::FLOAT32:
+                add_gemm_epilogue_task<float>(engine_, meta, reads, writes, s, alpha, beta, A, B, C, epilogue);
+                break;
+            case Core::DataType::FLOAT64:
+                add_gemm_epilogue_task<double>(engine_, meta, reads, writes, s, alpha, beta, A, B, C, epilogue);
+                break;
+            default:
+                SB_THROW_IF(true, "Unsupported data type for fused GEMM epilogue.");
+        }
+        return sycl::event(); 
+    }
 } // namespace SushiBLAS
@@ -118,13 +118,13 @@ namespace SushiBLAS
 
         // Capture data safely for asynchronous execution
         auto layout = A.layout;
-        void* read_A = A.storage ? A.storage->data_ptr : nullptr;
-        void* write_C = C.storage ? C.storage->data_ptr : nullptr;
+        void* read_A = A.storage ? A.data() : nullptr;
+        void* write_C = C.storage ? C.data() : nullptr;
 
-        std::vector<void*> reads = {};
-        if (read_A) reads.push_back(read_A);
-        std::vector<void*> writes = {};
-        if (write_C) writes.push_back(write_C);
+        std::vector<AccessRange> reads = {};
+        if (read_A) reads.push_back(A.access_range());
+        std::vector<AccessRange> writes = {};
+        if (write_C) writes.push_back(C.access_range());
 
         SushiRuntime::Graph::TaskMetadata meta;
         meta.name = "blas.lvl3.syrk";
@@ -135,55 +135,55 @@ namespace SushiBLAS
         meta.set_param(2, upper);
         meta.set_param(3, transA);
 
+        // n*(n+1)*k flops per batch (one triangle of C), one pass over A and C read and written
+        uint64_t un = static_cast<uint64_t>(n), uk = static_cast<uint64_t>(k), ub = static_cast<uint64_t>(batch_size);
+        OpCost cost{un * (un + 1) * uk * ub, (un * uk + 2 * un * un) * ub * Core::element_size(A.dtype)};
+
         // 2. Comprehensive Type Dispatching
         switch (A.dtype)
         {
             case Core::DataType::FLOAT32:
             {
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, mkl_uplo, mkl_trans, n, k, alpha, lda, str_a, beta, ldc, str_c, batch_size,
                      pA=A.data_as<float>(), pC=C.data_as<float>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event
                     {
                         return syrk_dispatch<float>(q, layout, mkl_uplo, mkl_trans, n, k, alpha, pA, lda, str_a, beta, pC, ldc, str_c, batch_size, deps);
-                    }
-                );
+                    }, {}, cost);
                 break;
             }
             case Core::DataType::FLOAT64:
             {
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, mkl_uplo, mkl_trans, n, k, alpha_d=static_cast<double>(alpha), lda, str_a, beta_d=static_cast<double>(beta), ldc, str_c, batch_size,
                      pA=A.data_as<double>(), pC=C.data_as<double>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event
                     {
                         return syrk_dispatch<double>(q, layout, mkl_uplo, mkl_trans, n, k, alpha_d, pA, lda, str_a, beta_d, pC, ldc, str_c, batch_size, deps);
-                    }
-                );
+                    }, {}, cost);
                 break;
             }
             case Core::DataType::COMPLEX32:
             {
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, mkl_uplo, mkl_trans, n, k, alpha_c=std::complex<float>(alpha, 0.0f), lda, str_a, beta_c=std::complex<float>(beta, 0.0f), ldc, str_c, batch_size,
                      pA=A.data_as<std::complex<float>>(), pC=C.data_as<std::complex<float>>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event
                     {
                         return syrk_dispatch<std::complex<float>>(q, layout, mkl_uplo, mkl_trans, n, k, alpha_c, pA, lda, str_a, beta_c, pC, ldc, str_c, batch_size, deps);
-                    }
-                );
+                    }, {}, cost);
                 break;
             }
             case Core::DataType::COMPLEX64:
             {
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, mkl_uplo, mkl_trans, n, k, alpha_c=std::complex<double>(alpha, 0.0), lda, str_a, beta_c=std::complex<double>(beta, 0.0), ldc, str_c, batch_size,
                      pA=A.data_as<std::complex<double>>(), pC=C.data_as<std::complex<double>>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event
                     {
                         return syrk_dispatch<std::complex<double>>(q, layout, mkl_uplo, mkl_trans, n, k, alpha_c, pA, lda, str_a, beta_c, pC, ldc, str_c, batch_size, deps);
-                    }
-                );
+                    }, {}, cost);
                 break;
             }
             default:
@@ -126,13 +126,13 @@ namespace SushiBLAS
 
         // Capture data safely for asynchronous execution
         auto layout = A.layout;
-        void* read_A = A.storage ? A.storage->data_ptr : nullptr;
-        void* write_B = B.storage ? B.storage->data_ptr : nullptr;
+        void* read_A = A.storage ? A.data() : nullptr;
+        void* write_B = B.storage ? B.data() : nullptr;
 
-        std::vector<void*> reads = {};
-        if (read_A) reads.push_back(read_A);
-        std::vector<void*> writes = {};
-        if (write_B) writes.push_back(write_B);
+        std::vector<AccessRange> reads = {};
+        if (read_A) reads.push_back(A.access_range());
+        std::vector<AccessRange> writes = {};
+        if (write_B) writes.push_back(B.access_range());
 
         SushiRuntime::Graph::TaskMetadata meta;
         meta.name = "blas.lvl3.trsm";
@@ -144,55 +144,56 @@ namespace SushiBLAS
         meta.set_param(3, transA);
         meta.set_param(4, unit_diag);
 
+        // the triangle of A times every column (left) or row (right) of B, B read and written
+        uint64_t um = static_cast<uint64_t>(m), un = static_cast<uint64_t>(n), ub = static_cast<uint64_t>(batch_size);
+        uint64_t ua = left_side ? um : un;
+        OpCost cost{um * un * ua * ub, (ua * ua + 2 * um * un) * ub * Core::element_size(A.dtype)};
+
         // 2. Comprehensive Type Dispatching
         switch (A.dtype)
         {
             case Core::DataType::FLOAT32:
             {
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, mkl_side, mkl_uplo, mkl_trans, mkl_diag, m, n, alpha, lda, str_a, ldb, str_b, batch_size,
                      pA=A.data_as<float>(), pB=B.data_as<float>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event
                     {
                         return trsm_dispatch<float>(q, layout, mkl_side, mkl_uplo, mkl_trans, mkl_diag, m, n, alpha, pA, lda, str_a, pB, ldb, str_b, batch_size, deps);
-                    }
-                );
+                    }, {}, cost);
                 break;
             }
             case Core::DataType::FLOAT64:
             {
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, mkl_side, mkl_uplo, mkl_trans, mkl_diag, m, n, alpha_d=static_cast<double>(alpha), lda, str_a, ldb, str_b, batch_size,
                      pA=A.data_as<double>(), pB=B.data_as<double>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event
                     {
                         return trsm_dispatch<double>(q, layout, mkl_side, mkl_uplo, mkl_trans, mkl_diag, m, n, alpha_d, pA, lda, str_a, pB, ldb, str_b, batch_size, deps);
-                    }
-                );
+                    }, {}, cost);
                 break;
             }
             case Core::DataType::COMPLEX32:
             {
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, mkl_side, mkl_uplo, mkl_trans, mkl_diag, m, n, alpha_c=std::complex<float>(alpha, 0.0f), lda, str_a, ldb, str_b, batch_size,
                      pA=A.data_as<std::complex<float>>(), pB=B.data_as<std::complex<float>>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event
                     {
                         return trsm_dispatch<std::complex<float>>(q, layout, mkl_side, mkl_uplo, mkl_trans, mkl_diag, m, n, alpha_c, pA, lda, str_a, pB, ldb, str_b, batch_size, deps);
-                    }
-                );
+                    }, {}, cost);
                 break;
             }
             case Core::DataType::COMPLEX64:
             {
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [layout, mkl_side, mkl_uplo, mkl_trans, mkl_diag, m, n, alpha_c=std::complex<double>(alpha, 0.0), lda, str_a, ldb, str_b, batch_size,
                      pA=A.data_as<std::complex<double>>(), pB=B.data_as<std::complex<double>>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event
                     {
                         return trsm_dispatch<std::complex<double>>(q, layout, mkl_side, mkl_uplo, mkl_trans, mkl_diag, m, n, alpha_c, pA, lda, str_a, pB, ldb, str_b, batch_size, deps);
-                    }
-                );
+                    }, {}, cost);
                 break;
             }
             default:
@@ -65,10 +65,10 @@ namespace SushiBLAS
         void* read_T = t.storage ? t.storage->data_ptr : nullptr;
         void* write_R = result.storage ? result.storage->data_ptr : nullptr;
 
-        std::vector<void*> reads = {};
-        if (read_T) reads.push_back(read_T);
-        std::vector<void*> writes = {};
-        if (write_R) writes.push_back(write_R);
+        std::vector<AccessRange> reads = {};
+        if (read_T) reads.push_back(t.access_range());
+        std::vector<AccessRange> writes = {};
+        if (write_R) writes.push_back(result.access_range());
 
         SushiRuntime::Graph::TaskMetadata meta;
         meta.name = "logic.all";
@@ -78,7 +78,7 @@ namespace SushiBLAS
         switch (t.dtype)
         {
             case Core::DataType::HALF:
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [size, pT=t.data_as<sycl::half>(), pR=result.data_as<sycl::half>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
                     {
@@ -86,7 +86,7 @@ namespace SushiBLAS
                     });
                 break;
             case Core::DataType::FLOAT32:
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [size, pT=t.data_as<float>(), pR=result.data_as<float>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
                     {
@@ -94,7 +94,7 @@ namespace SushiBLAS
                     });
                 break;
             case Core::DataType::FLOAT64:
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [size, pT=t.data_as<double>(), pR=result.data_as<double>()]
                     (sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
                     {
@@ -37,6 +37,7 @@
 #include <SushiBLAS/tensor.hpp>
 #include <SushiBLAS/core/logger.hpp>
 #include <SushiRuntime/graph/task_types.hpp>
+#include "../strided_internal.hpp"
 
 namespace SushiBLAS 
 {
@@ -54,8 +55,9 @@ namespace SushiBLAS
             SB_THROW_IF(x.dtype != result.dtype, "Data types must match for logic operation.");
 
             int64_t size = x.num_elements;
-            std::vector<void*> reads = {x.storage->data_ptr};
-            std::vector<void*> writes = {result.storage->data_ptr};
+            StridedShape<2> layout = make_strided<2>({&x, &result});
+            AccessRange reads[] = {x.access_range()};
+            AccessRange writes[] = {result.access_range()};
 
             SushiRuntime::Graph::TaskMetadata meta;
             meta.name = name;
@@ -63,29 +65,34 @@ namespace SushiBLAS
             meta.op_id = op_id;
             for (size_t i = 0; i < params.size(); ++i) meta.set_param(i, params[i]);
 
-            engine.get_graph().add_task(meta, reads, writes,
-                [size, px_raw = x.storage->data_ptr, pr_raw = result.storage->data_ptr, dtype = x.dtype, op_func, name](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
+            engine.add_task(meta, reads, writes,
+                [size, layout, px_raw = x.data(), pr_raw = result.data(), dtype = x.dtype, op_func, name](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
                 {
                     SB_LOG_INFO("Logic {}: {} elements", name, size);
                     return q.submit([&](sycl::handler& h) 
                     {
                         h.depends_on(deps);
+                        auto launch = [&](auto* px, auto* pr)
+                        {
+                            strided_for(h, layout, size, [=](const int64_t (&o)[2]) { pr[o[1]] = op_func(px[o[0]]); });
+                        };
+
                         switch (dtype) 
                         {
                             case Core::DataType::HALF:
-                                h.parallel_for(sycl::range<1>(size), [=, px = (sycl::half*)px_raw, pr = (sycl::half*)pr_raw](sycl::id<1> i) { pr[i] = op_func(px[i]); });
+                                launch((sycl::half*)px_raw, (sycl::half*)pr_raw);
                                 break;
                             case Core::DataType::FLOAT32:
-                                h.parallel_for(sycl::range<1>(size), [=, px = (float*)px_raw, pr = (float*)pr_raw](sycl::id<1> i) { pr[i] = op_func(px[i]); });
+                                launch((float*)px_raw, (float*)pr_raw);
                                 break;
                             case Core::DataType::FLOAT64:
-                                h.parallel_for(sycl::range<1>(size), [=, px = (double*)px_raw, pr = (double*)pr_raw](sycl::id<1> i) { pr[i] = op_func(px[i]); });
+                                launch((double*)px_raw, (double*)pr_raw);
                                 break;
                             case Core::DataType::COMPLEX32:
-                                h.parallel_for(sycl::range<1>(size), [=, px = (std::complex<float>*)px_raw, pr = (std::complex<float>*)pr_raw](sycl::id<1> i) { pr[i] = op_func(px[i]); });
+                                launch((std::complex<float>*)px_raw, (std::complex<float>*)pr_raw);
                                 break;
                             case Core::DataType::COMPLEX64:
-                                h.parallel_for(sycl::range<1>(size), [=, px = (std::complex<double>*)px_raw, pr = (std::complex<double>*)pr_raw](sycl::id<1> i) { pr[i] = op_func(px[i]); });
+                                launch((std::complex<double>*)px_raw, (std::complex<double>*)pr_raw);
                                 break;
                             default: break;
                         }
@@ -104,8 +111,9 @@ namespace SushiBLAS
             SB_THROW_IF(A.dtype != B.dtype || A.dtype != result.dtype, "Data types must match for logic operation.");
 
             int64_t size = A.num_elements;
-            std::vector<void*> reads = {A.storage->data_ptr, B.storage->data_ptr};
-            std::vector<void*> writes = {result.storage->data_ptr};
+            StridedShape<3> layout = make_strided<3>({&A, &B, &result});
+            AccessRange reads[] = {A.access_range(), B.access_range()};
+            AccessRange writes[] = {result.access_range()};
 
             SushiRuntime::Graph::TaskMetadata meta;
             meta.name = name;
@@ -113,29 +121,34 @@ namespace SushiBLAS
             meta.op_id = op_id;
             for (size_t i = 0; i < params.size(); ++i) meta.set_param(i, params[i]);
 
-            engine.get_graph().add_task(meta, reads, writes,
-                [size, pA_raw = A.storage->data_ptr, pB_raw = B.storage->data_ptr, pR_raw = result.storage->data_ptr, dtype = A.dtype, op_func, name](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
+            engine.add_task(meta, reads, writes,
+                [size, layout, pA_raw = A.data(), pB_raw = B.data(), pR_raw = result.data(), dtype = A.dtype, op_func, name](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
                 {
                     SB_LOG_INFO("Logic {}: {} elements", name, size);
                     return q.submit([&](sycl::handler& h) 
                     {
                         h.depends_on(deps);
+                        auto launch = [&](auto* pA, auto* pB, auto* pR)
+                        {
+                            strided_for(h, layout, size, [=](const int64_t (&o)[3]) { pR[o[2]] = op_func(pA[o[0]], pB[o[1]]); });
+                        };
+
                         switch (dtype) 
                         {
                             case Core::DataType::HALF:
-                                h.parallel_for(sycl::range<1>(size), [=, pA = (sycl::half*)pA_raw, pB = (sycl::half*)pB_raw, pR = (sycl::half*)pR_raw](sycl::id<1> i) { pR[i] = op_func(pA[i], pB[i]); });
+                                launch((sycl::half*)pA_raw, (sycl::half*)pB_raw, (sycl::half*)pR_raw);
                                 break;
                             case Core::DataType::FLOAT32:
-                                h.parallel_for(sycl::range<1>(size), [=, pA = (float*)pA_raw, pB = (float*)pB_raw, pR = (float*)pR_raw](sycl::id<1> i) { pR[i] = op_func(pA[i], pB[i]); });
+                                launch((float*)pA_raw, (float*)pB_raw, (float*)pR_raw);
                                 break;
                             case Core::DataType::FLOAT64:
-                                h.parallel_for(sycl::range<1>(size), [=, pA = (double*)pA_raw, pB = (double*)pB_raw, pR = (double*)pR_raw](sycl::id<1> i) { pR[i] = op_func(pA[i], pB[i]); });
+                                launch((double*)pA_raw, (double*)pB_raw, (double*)pR_raw);
                                 break;
                             case Core::DataType::COMPLEX32:
-                                h.parallel_for(sycl::range<1>(size), [=, pA = (std::complex<float>*)pA_raw, pB = (std::complex<float>*)pB_raw, pR = (std::complex<float>*)pR_raw](sycl::id<1> i) { pR[i] = op_func(pA[i], pB[i]); });
+                                launch((std::complex<float>*)pA_raw, (std::complex<float>*)pB_raw, (std::complex<float>*)pR_raw);
                                 break;
                             case Core::DataType::COMPLEX64:
-                                h.parallel_for(sycl::range<1>(size), [=, pA = (std::complex<double>*)pA_raw, pB = (std::complex<double>*)pB_raw, pR = (std::complex<double>*)pR_raw](sycl::id<1> i) { pR[i] = op_func(pA[i], pB[i]); });
+                                launch((std::complex<double>*)pA_raw, (std::complex<double>*)pB_raw, (std::complex<double>*)pR_raw);
                                 break;
                             default: break;
                         }
@@ -187,8 +200,9 @@ namespace SushiBLAS
             SB_THROW_IF(cond.dtype != A.dtype || cond.dtype != B.dtype || cond.dtype != result.dtype, "Data types must match for logic operation.");
 
             int64_t size = cond.num_elements;
-            std::vector<void*> reads = {cond.storage->data_ptr, A.storage->data_ptr, B.storage->data_ptr};
-            std::vector<void*> writes = {result.storage->data_ptr};
+            StridedShape<4> layout = make_strided<4>({&cond, &A, &B, &result});
+            AccessRange reads[] = {cond.access_range(), A.access_range(), B.access_range()};
+            AccessRange writes[] = {result.access_range()};
 
             SushiRuntime::Graph::TaskMetadata meta;
             meta.name = name;
@@ -196,29 +210,34 @@ namespace SushiBLAS
             meta.op_id = op_id;
             for (size_t i = 0; i < params.size(); ++i) meta.set_param(i, params[i]);
 
-            engine.get_graph().add_task(meta, reads, writes,
-                [size, pC_raw = cond.storage->data_ptr, pA_raw = A.storage->data_ptr, pB_raw = B.storage->data_ptr, pR_raw = result.storage->data_ptr, dtype = cond.dtype, op_func, name](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
+            engine.add_task(meta, reads, writes,
+                [size, layout, pC_raw = cond.data(), pA_raw = A.data(), pB_raw = B.data(), pR_raw = result.data(), dtype = cond.dtype, op_func, name](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
                 {
                     SB_LOG_INFO("Logic {}: {} elements", name, size);
                     return q.submit([&](sycl::handler& h) 
                     {
                         h.depends_on(deps);
+                        auto launch = [&](auto* pC, auto* pA, auto* pB, auto* pR)
+                        {
+                            strided_for(h, layout, size, [=](const int64_t (&o)[4]) { pR[o[3]] = op_func(pC[o[0]], pA[o[1]], pB[o[2]]); });
+                        };
+
                         switch (dtype) 
                         {
                             case Core::DataType::HALF:
-                                h.parallel_for(sycl::range<1>(size), [=, pC = (sycl::half*)pC_raw, pA = (sycl::half*)pA_raw, pB = (sycl::half*)pB_raw, pR = (sycl::half*)pR_raw](sycl::id<1> i) { pR[i] = op_func(pC[i], pA[i], pB[i]); });
+                                launch((sycl::half*)pC_raw, (sycl::half*)pA_raw, (sycl::half*)pB_raw, (sycl::half*)pR_raw);
                                 break;
                             case Core::DataType::FLOAT32:
-                                h.parallel_for(sycl::range<1>(size), [=, pC = (float*)pC_raw, pA = (float*)pA_raw, pB = (float*)pB_raw, pR = (float*)pR_raw](sycl::id<1> i) { pR[i] = op_func(pC[i], pA[i], pB[i]); });
+                                launch((float*)pC_raw, (float*)pA_raw, (float*)pB_raw, (float*)pR_raw);
                                 break;
                             case Core::DataType::FLOAT64:
-                                h.parallel_for(sycl::range<1>(size), [=, pC = (double*)pC_raw, pA = (double*)pA_raw, pB = (double*)pB_raw, pR = (double*)pR_raw](sycl::id<1> i) { pR[i] = op_func(pC[i], pA[i], pB[i]); });
+                                launch((double*)pC_raw, (double*)pA_raw, (double*)pB_raw, (double*)pR_raw);
                                 break;
                             case Core::DataType::COMPLEX32:
-                                h.parallel_for(sycl::range<1>(size), [=, pC = (std::complex<float>*)pC_raw, pA = (std::complex<float>*)pA_raw, pB = (std::complex<float>*)pB_raw, pR = (std::complex<float>*)pR_raw](sycl::id<1> i) { pR[i] = op_func(pC[i], pA[i], pB[i]); });
+                                launch((std::complex<float>*)pC_raw, (std::complex<float>*)pA_raw, (std::complex<float>*)pB_raw, (std::complex<float>*)pR_raw);
                                 break;
                             case Core::DataType::COMPLEX64:
-                                h.parallel_for(sycl::range<1>(size), [=, pC = (std::complex<double>*)pC_raw, pA = (std::complex<double>*)pA_raw, pB = (std::complex<double>*)pB_raw, pR = (std::complex<double>*)pR_raw](sycl::id<1> i) { pR[i] = op_func(pC[i], pA[i], pB[i]); });
+                                launch((std::complex<double>*)pC_raw, (std::complex<double>*)pA_raw, (std::complex<double>*)pB_raw, (std::complex<double>*)pR_raw);
                                 break;
                             default: break;
                         }
@@ -38,4 +38,10 @@ namespace SushiBLAS
         return Internal::execute_unary_inplace(engine_, t, "math.ew.abs", "math.ew.abs"_op, 
             [](auto x) { return sycl::fabs(x); });
     }
+
+    sycl::event ElementwiseOps::abs(const Tensor& in, Tensor& out) 
+    {
+        return Internal::execute_unary(engine_, in, out, "math.ew.abs", "math.ew.abs"_op, 
+            [](auto x) { return sycl::fabs(x); });
+    }
 } // namespace SushiBLAS
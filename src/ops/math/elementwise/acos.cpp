@@ -38,4 +38,10 @@ namespace SushiBLAS
         return Internal::execute_unary_inplace(engine_, t, "math.ew.acos", "math.ew.acos"_op, 
             [](auto x) { return sycl::acos(x); });
     }
+
+    sycl::event ElementwiseOps::acos(const Tensor& in, Tensor& out) 
+    {
+        return Internal::execute_unary(engine_, in, out, "math.ew.acos", "math.ew.acos"_op, 
+            [](auto x) { return sycl::acos(x); });
+    }
 } // namespace SushiBLAS
@@ -38,4 +38,10 @@ namespace SushiBLAS
         return Internal::execute_unary_inplace(engine_, t, "math.ew.acosh", "math.ew.acosh"_op, 
             [](auto x) { return sycl::acosh(x); });
     }
+
+    sycl::event ElementwiseOps::acosh(const Tensor& in, Tensor& out) 
+    {
+        return Internal::execute_unary(engine_, in, out, "math.ew.acosh", "math.ew.acosh"_op, 
+            [](auto x) { return sycl::acosh(x); });
+    }
 } // namespace SushiBLAS
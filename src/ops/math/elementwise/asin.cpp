@@ -38,4 +38,10 @@ namespace SushiBLAS
         return Internal::execute_unary_inplace(engine_, t, "math.ew.asin", "math.ew.asin"_op, 
             [](auto x) { return sycl::asin(x); });
     }
+
+    sycl::event ElementwiseOps::asin(const Tensor& in, Tensor& out) 
+    {
+        return Internal::execute_unary(engine_, in, out, "math.ew.asin", "math.ew.asin"_op, 
+            [](auto x) { return sycl::asin(x); });
+    }
 } // namespace SushiBLAS
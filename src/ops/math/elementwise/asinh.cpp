@@ -38,4 +38,10 @@ namespace SushiBLAS
         return Internal::execute_unary_inplace(engine_, t, "math.ew.asinh", "math.ew.asinh"_op, 
             [](auto x) { return sycl::asinh(x); });
     }
+
+    sycl::event ElementwiseOps::asinh(const Tensor& in, Tensor& out) 
+    {
+        return Internal::execute_unary(engine_, in, out, "math.ew.asinh", "math.ew.asinh"_op, 
+            [](auto x) { return sycl::asinh(x); });
+    }
 } // namespace SushiBLAS
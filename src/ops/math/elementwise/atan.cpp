@@ -38,4 +38,10 @@ namespace SushiBLAS
         return Internal::execute_unary_inplace(engine_, t, "math.ew.atan", "math.ew.atan"_op, 
             [](auto x) { return sycl::atan(x); });
     }
+
+    sycl::event ElementwiseOps::atan(const Tensor& in, Tensor& out) 
+    {
+        return Internal::execute_unary(engine_, in, out, "math.ew.atan", "math.ew.atan"_op, 
+            [](auto x) { return sycl::atan(x); });
+    }
 } // namespace SushiBLAS
@@ -38,4 +38,10 @@ namespace SushiBLAS
         return Internal::execute_unary_inplace(engine_, t, "math.ew.atanh", "math.ew.atanh"_op, 
             [](auto x) { return sycl::atanh(x); });
     }
+
+    sycl::event ElementwiseOps::atanh(const Tensor& in, Tensor& out) 
+    {
+        return Internal::execute_unary(engine_, in, out, "math.ew.atanh", "math.ew.atanh"_op, 
+            [](auto x) { return sycl::atanh(x); });
+    }
 } // namespace SushiBLAS
@@ -38,4 +38,10 @@ namespace SushiBLAS
         return Internal::execute_unary_inplace(engine_, t, "math.ew.ceil", "math.ew.ceil"_op, 
             [](auto x) { return sycl::ceil(x); });
     }
+
+    sycl::event ElementwiseOps::ceil(const Tensor& in, Tensor& out) 
+    {
+        return Internal::execute_unary(engine_, in, out, "math.ew.ceil", "math.ew.ceil"_op, 
+            [](auto x) { return sycl::ceil(x); });
+    }
 } // namespace SushiBLAS
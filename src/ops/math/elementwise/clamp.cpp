@@ -39,4 +39,11 @@ namespace SushiBLAS
             [min_val, max_val](auto x) { return sycl::clamp(x, (decltype(x))min_val, (decltype(x))max_val); },
             {min_val, max_val});
     }
+
+    sycl::event ElementwiseOps::clamp(const Tensor& in, Tensor& out, float min_val, float max_val) 
+    {
+        return Internal::execute_unary(engine_, in, out, "math.ew.clamp", "math.ew.clamp"_op, 
+            [min_val, max_val](auto x) { return sycl::clamp(x, (decltype(x))min_val, (decltype(x))max_val); },
+            {min_val, max_val});
+    }
 } // namespace SushiBLAS
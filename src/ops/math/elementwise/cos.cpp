@@ -38,4 +38,10 @@ namespace SushiBLAS
         return Internal::execute_unary_inplace(engine_, t, "math.ew.cos", "math.ew.cos"_op, 
             [](auto x) { return sycl::cos(x); });
     }
+
+    sycl::event ElementwiseOps::cos(const Tensor& in, Tensor& out) 
+    {
+        return Internal::execute_unary(engine_, in, out, "math.ew.cos", "math.ew.cos"_op, 
+            [](auto x) { return sycl::cos(x); });
+    }
 } // namespace SushiBLAS
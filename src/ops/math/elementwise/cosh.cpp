@@ -38,4 +38,10 @@ namespace SushiBLAS
         return Internal::execute_unary_inplace(engine_, t, "math.ew.cosh", "math.ew.cosh"_op, 
             [](auto x) { return sycl::cosh(x); });
     }
+
+    sycl::event ElementwiseOps::cosh(const Tensor& in, Tensor& out) 
+    {
+        return Internal::execute_unary(engine_, in, out, "math.ew.cosh", "math.ew.cosh"_op, 
+            [](auto x) { return sycl::cosh(x); });
+    }
 } // namespace SushiBLAS
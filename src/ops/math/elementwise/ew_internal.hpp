@@ -30,13 +30,18 @@
 
 #pragma once
 
+#include <array>
 #include <vector>
 #include <complex>
+#include <utility>
+#include <algorithm>
 #include <sycl/sycl.hpp>
 #include <SushiBLAS/engine.hpp>
 #include <SushiBLAS/tensor.hpp>
 #include <SushiBLAS/core/logger.hpp>
 #include <SushiRuntime/graph/task_types.hpp>
+#include "../../strided_internal.hpp"
+#include "../../vector_internal.hpp"
 
 namespace SushiBLAS
 {
@@ -51,13 +56,18 @@ namespace SushiBLAS
 
         /**
         * @brief Helper for unary in-place elementwise operations.
+        * 
+        * Views are updated in place through their strides. Contiguous aligned tensors 
+        * use vector_for(), and only contiguous tensors take part in fusion.
         */
         template<typename Func>
         sycl::event execute_unary_inplace(Engine& engine, Tensor& t, const char* name, SushiRuntime::Graph::OpID op_id, Func&& op_func, const std::vector<float>& params = {}) 
         {
             int64_t size = t.num_elements;
-            void* ptr = t.storage ? t.storage->data_ptr : nullptr;
-            std::vector<void*> rw = ptr ? std::vector<void*>{ptr} : std::vector<void*>{};
+            void* ptr = t.storage && t.storage->data_ptr ? t.data() : nullptr;
+            StridedShape<1> layout = make_strided<1>({&t});
+            bool vectorize = layout.contiguous() && can_vectorize({&t});
+            AccessRange rw[] = {t.access_range()};
 
             SushiRuntime::Graph::TaskMetadata meta;
             meta.name = name;
@@ -65,45 +75,115 @@ namespace SushiBLAS
             meta.op_id = op_id;
             for (size_t i = 0; i < params.size(); ++i) meta.set_param(i, params[i]);
 
-            engine.get_graph().add_task(meta, rw, rw,
-                [size, ptr, dtype = t.dtype, op_func, name](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
+            FusionInfo fusion = layout.contiguous() ? make_fusion_info(ptr, nullptr, nullptr, size, t.dtype) : FusionInfo{};
+
+            engine.add_task(meta, rw, rw,
+                [size, ptr, layout, vectorize, dtype = t.dtype, op_func, name](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
                 {
                     SB_LOG_INFO("Elementwise {} (In-place): {} elements", name, size);
                     return q.submit([&](sycl::handler& h) 
                     {
                         h.depends_on(deps);
+                        auto launch = [&](auto* p)
+                        {
+                            if (vectorize) vector_for(h, size, p, op_func, p);
+                            else strided_for(h, layout, size, [=](const int64_t (&o)[1]) { p[o[0]] = op_func(p[o[0]]); });
+                        };
+
                         switch (dtype) 
                         {
-                            case Core::DataType::HALF:
-                                h.parallel_for(sycl::range<1>(size), [=, p = (sycl::half*)ptr](sycl::id<1> i) { p[i] = op_func(p[i]); });
-                                break;
-                            case Core::DataType::FLOAT32:
-                                h.parallel_for(sycl::range<1>(size), [=, p = (float*)ptr](sycl::id<1> i) { p[i] = op_func(p[i]); });
-                                break;
-                            case Core::DataType::FLOAT64:
-                                h.parallel_for(sycl::range<1>(size), [=, p = (double*)ptr](sycl::id<1> i) { p[i] = op_func(p[i]); });
-                                break;
+                            case Core::DataType::HALF:    launch((sycl::half*)ptr); break;
+                            case Core::DataType::FLOAT32: launch((float*)ptr); break;
+                            case Core::DataType::FLOAT64: launch((double*)ptr); break;
                             default: break;
                         }
                     });
-                });
+                }, fusion, {static_cast<uint64_t>(size)});
             return sycl::event();
         }
 
         /**
-        * @brief Helper for binary elementwise operations (C = op(A, B)).
+        * @brief Broadcast the inputs to the shape of the output with NumPy rules.
+        * 
+        * Shapes are aligned at the last dimension. Each input dimension must match the 
+        * output or be 1, and missing leading dimensions count as 1. The output must have 
+        * exactly the broadcast shape. A dimension that an input lacks or has with size 1 
+        * gets stride 0, so the kernel reads the same element along it and nothing is materialised.
+        * @param operands The inputs followed by the output.
+        * @return The shape of the output and the strides of every operand, in the same order.
+        * @throws std::runtime_error If the shapes cannot be broadcast to the output.
         */
-        template<typename Func>
-        sycl::event execute_binary(Engine& engine, const Tensor& A, const Tensor& B, Tensor& C, const char* name, SushiRuntime::Graph::OpID op_id, Func&& op_func, const std::vector<float>& params = {}) 
+        template<int N>
+        inline StridedShape<N> make_broadcast(const std::array<const Tensor*, N>& operands)
         {
-            SB_THROW_IF(A.num_elements != B.num_elements || A.num_elements != C.num_elements, 
-                    "Tensor sizes must match for elementwise operation.");
-            SB_THROW_IF(A.dtype != B.dtype || A.dtype != C.dtype, 
-                    "Tensor data types must match for elementwise operation.");
+            const Tensor& out = *operands[N - 1];
+
+            StridedShape<N> bc;
+            bc.rank = out.rank;
+            for (int k = 0; k < N - 1; ++k)
+                SB_THROW_IF(out.rank < operands[k]->rank, 
+                            "Output rank {} is smaller than the rank {} of input {}.", out.rank, operands[k]->rank, k);
+
+            for (int d = 0; d < out.rank; ++d)
+            {
+                int64_t widest = 1;
+                for (int k = 0; k < N - 1; ++k)
+                {
+                    const Tensor& in = *operands[k];
+                    int di = d - (out.rank - in.rank);
+                    int64_t size = di >= 0 ? in.shape[di] : 1;
+
+                    SB_THROW_IF(size != out.shape[d] && size != 1,
+                                "Shapes cannot be broadcast: input {} has size {} in dimension {}, output has {}.", k, size, d, out.shape[d]);
 
-            int64_t size = A.num_elements;
-            std::vector<void*> reads = {A.storage->data_ptr, B.storage->data_ptr};
-            std::vector<void*> writes = {C.storage->data_ptr};
+                    widest = std::max(widest, size);
+                    bc.strides[k][d] = size == 1 ? 0 : in.strides[di];
+                }
+                SB_THROW_IF(widest != out.shape[d],
+                            "Shapes cannot be broadcast: output has size {} in dimension {}, inputs have {}.", out.shape[d], d, widest);
+
+                bc.shape[d] = out.shape[d];
+                bc.strides[N - 1][d] = out.strides[d];
+            }
+            bc.coalesce();
+            return bc;
+        }
+
+        /**
+        * @brief Helper for out-of-place elementwise operations (out = op(inputs...)).
+        * 
+        * Operands are indexed through their strides, so any of them can be a view. 
+        * Inputs with fewer elements than out are broadcast to the shape of out (see 
+        * make_broadcast()). Contiguous aligned operands use vector_for(). Binary 
+        * operations on contiguous operands take part in fusion.
+        * @tparam N The number of inputs.
+        */
+        template<int N, typename Func>
+        sycl::event execute_elementwise(Engine& engine, const std::array<const Tensor*, N>& inputs, Tensor& out, const char* name, SushiRuntime::Graph::OpID op_id, Func&& op_func, const std::vector<float>& params = {}) 
+        {
+            std::array<const Tensor*, N + 1> operands;
+            std::array<void*, N> in_raw;
+            bool broadcast = false;
+            uint64_t elements = static_cast<uint64_t>(out.num_elements);
+            for (int k = 0; k < N; ++k)
+            {
+                SB_THROW_IF(inputs[k]->dtype != out.dtype, 
+                            "Tensor data types must match for elementwise operation.");
+                operands[k] = inputs[k];
+                in_raw[k] = inputs[k]->data();
+                broadcast = broadcast || inputs[k]->num_elements != out.num_elements;
+                elements += static_cast<uint64_t>(inputs[k]->num_elements);
+            }
+            operands[N] = &out;
+
+            StridedShape<N + 1> layout = broadcast ? make_broadcast<N + 1>(operands) : make_strided<N + 1>(operands);
+            bool vectorize = layout.contiguous();
+            for (const Tensor* t : operands) vectorize = vectorize && can_vectorize({t});
+
+            int64_t size = out.num_elements;
+            AccessRange reads[N];
+            for (int k = 0; k < N; ++k) reads[k] = inputs[k]->access_range();
+            AccessRange writes[] = {out.access_range()};
 
             SushiRuntime::Graph::TaskMetadata meta;
             meta.name = name;
@@ -111,31 +191,71 @@ namespace SushiBLAS
             meta.op_id = op_id;
             for (size_t i = 0; i < params.size(); ++i) meta.set_param(i, params[i]);
 
-            engine.get_graph().add_task(meta, reads, writes,
-                [size, pA_raw = A.storage->data_ptr, pB_raw = B.storage->data_ptr, pC_raw = C.storage->data_ptr, dtype = A.dtype, op_func, name](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
+            void* out_raw = out.data();
+            FusionInfo fusion;
+            if constexpr (N == 2)
+            {
+                if (layout.contiguous()) fusion = make_fusion_info(out_raw, in_raw[0], in_raw[1], size, out.dtype);
+            }
+            uint64_t bytes = elements * Core::element_size(out.dtype);
+
+            engine.add_task(meta, reads, writes,
+                [size, layout, broadcast, vectorize, in_raw, out_raw, dtype = out.dtype, op_func, name](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
                 {
-                    SB_LOG_INFO("Elementwise {}: {} elements", name, size);
+                    SB_LOG_INFO("Elementwise {}{}: {} elements", name, broadcast ? " (broadcast)" : "", size);
                     return q.submit([&](sycl::handler& h) 
                     {
                         h.depends_on(deps);
+                        auto launch = [&]<typename T, size_t... I>(T* pOut, std::index_sequence<I...>)
+                        {
+                            if (vectorize) 
+                            {
+                                vector_for(h, size, pOut, op_func, static_cast<const T*>(in_raw[I])...);
+                                return;
+                            }
+                            std::array<const T*, N> pIn = {static_cast<const T*>(in_raw[I])...};
+                            strided_for(h, layout, size, [=](const int64_t (&o)[N + 1]) { pOut[o[N]] = op_func(pIn[I][o[I]]...); });
+                        };
+
                         switch (dtype) 
                         {
                             case Core::DataType::HALF:
-                                h.parallel_for(sycl::range<1>(size), [=, pA = (sycl::half*)pA_raw, pB = (sycl::half*)pB_raw, pC = (sycl::half*)pC_raw](sycl::id<1> i) { pC[i] = op_func(pA[i], pB[i]); });
+                                launch((sycl::half*)out_raw, std::make_index_sequence<N>{});
                                 break;
                             case Core::DataType::FLOAT32:
-                                h.parallel_for(sycl::range<1>(size), [=, pA = (float*)pA_raw, pB = (float*)pB_raw, pC = (float*)pC_raw](sycl::id<1> i) { pC[i] = op_func(pA[i], pB[i]); });
+                                launch((float*)out_raw, std::make_index_sequence<N>{});
                                 break;
                             case Core::DataType::FLOAT64:
-                                h.parallel_for(sycl::range<1>(size), [=, pA = (double*)pA_raw, pB = (double*)pB_raw, pC = (double*)pC_raw](sycl::id<1> i) { pC[i] = op_func(pA[i], pB[i]); });
+                                launch((double*)out_raw, std::make_index_sequence<N>{});
                                 break;
                             default: break;
                         }
                     });
-                });
+                }, fusion, {static_cast<uint64_t>(size), bytes});
             return sycl::event();
         }
 
+        /** @brief Helper for out-of-place unary elementwise operations (out = op(in)). */
+        template<typename Func>
+        sycl::event execute_unary(Engine& engine, const Tensor& in, Tensor& out, const char* name, SushiRuntime::Graph::OpID op_id, Func&& op_func, const std::vector<float>& params = {}) 
+        {
+            return execute_elementwise<1>(engine, {&in}, out, name, op_id, std::forward<Func>(op_func), params);
+        }
+
+        /** @brief Helper for binary elementwise operations (C = op(A, B)). */
+        template<typename Func>
+        sycl::event execute_binary(Engine& engine, const Tensor& A, const Tensor& B, Tensor& C, const char* name, SushiRuntime::Graph::OpID op_id, Func&& op_func, const std::vector<float>& params = {}) 
+        {
+            return execute_elementwise<2>(engine, {&A, &B}, C, name, op_id, std::forward<Func>(op_func), params);
+        }
+
+        /** @brief Helper for ternary elementwise operations (out = op(A, B, C)). They are not fused. */
+        template<typename Func>
+        sycl::event execute_ternary(Engine& engine, const Tensor& A, const Tensor& B, const Tensor& C, Tensor& out, const char* name, SushiRuntime::Graph::OpID op_id, Func&& op_func, const std::vector<float>& params = {}) 
+        {
+            return execute_elementwise<3>(engine, {&A, &B, &C}, out, name, op_id, std::forward<Func>(op_func), params);
+        }
+
         template<typename T>
         inline T safe_ew_add(T a, T b) { return a + b; }
         template<typename T>
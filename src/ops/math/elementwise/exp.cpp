@@ -38,4 +38,10 @@ namespace SushiBLAS
         return Internal::execute_unary_inplace(engine_, t, "math.ew.exp", "math.ew.exp"_op, 
             [](auto x) { return sycl::exp(x); });
     }
+
+    sycl::event ElementwiseOps::exp(const Tensor& in, Tensor& out) 
+    {
+        return Internal::execute_unary(engine_, in, out, "math.ew.exp", "math.ew.exp"_op, 
+            [](auto x) { return sycl::exp(x); });
+    }
 } // namespace SushiBLAS
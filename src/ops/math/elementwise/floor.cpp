@@ -38,4 +38,10 @@ namespace SushiBLAS
         return Internal::execute_unary_inplace(engine_, t, "math.ew.floor", "math.ew.floor"_op, 
             [](auto x) { return sycl::floor(x); });
     }
+
+    sycl::event ElementwiseOps::floor(const Tensor& in, Tensor& out) 
+    {
+        return Internal::execute_unary(engine_, in, out, "math.ew.floor", "math.ew.floor"_op, 
+            [](auto x) { return sycl::floor(x); });
+    }
 } // namespace SushiBLAS
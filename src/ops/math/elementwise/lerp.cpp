@@ -0,0 +1,48 @@
+/**************************************************************************/
+/* lerp.cpp                                                               */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <SushiBLAS/ops/math/elementwise.hpp>
+#include "ew_internal.hpp"
+
+namespace SushiBLAS 
+{
+    sycl::event ElementwiseOps::lerp(const Tensor& start, const Tensor& end, const Tensor& weight, Tensor& out) 
+    {
+        return Internal::execute_ternary(engine_, start, end, weight, out, "math.ew.lerp", "math.ew.lerp"_op, 
+            [](auto s, auto e, auto w) { return s + w * (e - s); });
+    }
+
+    sycl::event ElementwiseOps::lerp(const Tensor& start, const Tensor& end, float weight, Tensor& out) 
+    {
+        return Internal::execute_binary(engine_, start, end, out, "math.ew.lerp_scalar", "math.ew.lerp_scalar"_op, 
+            [weight](auto s, auto e) { return s + (decltype(s))weight * (e - s); },
+            {weight});
+    }
+} // namespace SushiBLAS
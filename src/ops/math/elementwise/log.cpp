@@ -38,4 +38,10 @@ namespace SushiBLAS
         return Internal::execute_unary_inplace(engine_, t, "math.ew.log", "math.ew.log"_op, 
             [](auto x) { return sycl::log(x); });
     }
+
+    sycl::event ElementwiseOps::log(const Tensor& in, Tensor& out) 
+    {
+        return Internal::execute_unary(engine_, in, out, "math.ew.log", "math.ew.log"_op, 
+            [](auto x) { return sycl::log(x); });
+    }
 } // namespace SushiBLAS
@@ -38,4 +38,10 @@ namespace SushiBLAS
         return Internal::execute_unary_inplace(engine_, t, "math.ew.neg", "math.ew.neg"_op, 
             [](auto x) { return -x; });
     }
+
+    sycl::event ElementwiseOps::neg(const Tensor& in, Tensor& out) 
+    {
+        return Internal::execute_unary(engine_, in, out, "math.ew.neg", "math.ew.neg"_op, 
+            [](auto x) { return -x; });
+    }
 } // namespace SushiBLAS
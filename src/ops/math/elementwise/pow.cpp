@@ -39,4 +39,11 @@ namespace SushiBLAS
             [exponent](auto x) { return sycl::pow(x, (decltype(x))exponent); },
             {exponent});
     }
+
+    sycl::event ElementwiseOps::pow(const Tensor& in, Tensor& out, float exponent) 
+    {
+        return Internal::execute_unary(engine_, in, out, "math.ew.pow", "math.ew.pow"_op, 
+            [exponent](auto x) { return sycl::pow(x, (decltype(x))exponent); },
+            {exponent});
+    }
 } // namespace SushiBLAS
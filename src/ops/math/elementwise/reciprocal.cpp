@@ -38,4 +38,10 @@ namespace SushiBLAS
         return Internal::execute_unary_inplace(engine_, t, "math.ew.reciprocal", "math.ew.reciprocal"_op, 
             [](auto x) { return (decltype(x))1 / x; });
     }
+
+    sycl::event ElementwiseOps::reciprocal(const Tensor& in, Tensor& out) 
+    {
+        return Internal::execute_unary(engine_, in, out, "math.ew.reciprocal", "math.ew.reciprocal"_op, 
+            [](auto x) { return (decltype(x))1 / x; });
+    }
 } // namespace SushiBLAS
@@ -38,4 +38,10 @@ namespace SushiBLAS
         return Internal::execute_unary_inplace(engine_, t, "math.ew.round", "math.ew.round"_op, 
             [](auto x) { return sycl::round(x); });
     }
+
+    sycl::event ElementwiseOps::round(const Tensor& in, Tensor& out) 
+    {
+        return Internal::execute_unary(engine_, in, out, "math.ew.round", "math.ew.round"_op, 
+            [](auto x) { return sycl::round(x); });
+    }
 } // namespace SushiBLAS
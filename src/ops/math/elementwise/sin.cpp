@@ -38,4 +38,10 @@ namespace SushiBLAS
         return Internal::execute_unary_inplace(engine_, t, "math.ew.sin", "math.ew.sin"_op, 
             [](auto x) { return sycl::sin(x); });
     }
+
+    sycl::event ElementwiseOps::sin(const Tensor& in, Tensor& out) 
+    {
+        return Internal::execute_unary(engine_, in, out, "math.ew.sin", "math.ew.sin"_op, 
+            [](auto x) { return sycl::sin(x); });
+    }
 } // namespace SushiBLAS
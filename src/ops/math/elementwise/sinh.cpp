@@ -38,4 +38,10 @@ namespace SushiBLAS
         return Internal::execute_unary_inplace(engine_, t, "math.ew.sinh", "math.ew.sinh"_op, 
             [](auto x) { return sycl::sinh(x); });
     }
+
+    sycl::event ElementwiseOps::sinh(const Tensor& in, Tensor& out) 
+    {
+        return Internal::execute_unary(engine_, in, out, "math.ew.sinh", "math.ew.sinh"_op, 
+            [](auto x) { return sycl::sinh(x); });
+    }
 } // namespace SushiBLAS
@@ -38,4 +38,10 @@ namespace SushiBLAS
         return Internal::execute_unary_inplace(engine_, t, "math.ew.sqrt", "math.ew.sqrt"_op, 
             [](auto x) { return sycl::sqrt(x); });
     }
+
+    sycl::event ElementwiseOps::sqrt(const Tensor& in, Tensor& out) 
+    {
+        return Internal::execute_unary(engine_, in, out, "math.ew.sqrt", "math.ew.sqrt"_op, 
+            [](auto x) { return sycl::sqrt(x); });
+    }
 } // namespace SushiBLAS
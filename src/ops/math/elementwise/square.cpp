@@ -38,4 +38,10 @@ namespace SushiBLAS
         return Internal::execute_unary_inplace(engine_, t, "math.ew.square", "math.ew.square"_op, 
             [](auto x) { return x * x; });
     }
+
+    sycl::event ElementwiseOps::square(const Tensor& in, Tensor& out) 
+    {
+        return Internal::execute_unary(engine_, in, out, "math.ew.square", "math.ew.square"_op, 
+            [](auto x) { return x * x; });
+    }
 } // namespace SushiBLAS
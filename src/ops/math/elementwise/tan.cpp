@@ -38,4 +38,10 @@ namespace SushiBLAS
         return Internal::execute_unary_inplace(engine_, t, "math.ew.tan", "math.ew.tan"_op, 
             [](auto x) { return sycl::tan(x); });
     }
+
+    sycl::event ElementwiseOps::tan(const Tensor& in, Tensor& out) 
+    {
+        return Internal::execute_unary(engine_, in, out, "math.ew.tan", "math.ew.tan"_op, 
+            [](auto x) { return sycl::tan(x); });
+    }
 } // namespace SushiBLAS
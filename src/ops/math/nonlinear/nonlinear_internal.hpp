@@ -37,6 +37,8 @@
 #include <SushiBLAS/tensor.hpp>
 #include <SushiBLAS/core/logger.hpp>
 #include <SushiRuntime/graph/task_types.hpp>
+#include "../../strided_internal.hpp"
+#include "../../vector_internal.hpp"
 
 namespace SushiBLAS 
 {
@@ -46,13 +48,18 @@ namespace SushiBLAS
     {
         /**
          * @brief Helper for nonlinear forward operations.
+         * 
+         * Views are updated in place through their strides. Contiguous aligned real 
+         * tensors use vector_for(), and only contiguous tensors take part in fusion.
          */
         template<typename Func>
         sycl::event execute_nonlinear_forward(Engine& engine, Tensor& t, const char* name, SushiRuntime::Graph::OpID op_id, Func&& op_func, const std::vector<float>& params = {}) 
         {
             int64_t size = t.num_elements;
-            void* ptr = t.storage ? t.storage->data_ptr : nullptr;
-            std::vector<void*> rw = ptr ? std::vector<void*>{ptr} : std::vector<void*>{};
+            void* ptr = t.storage && t.storage->data_ptr ? t.data() : nullptr;
+            StridedShape<1> layout = make_strided<1>({&t});
+            bool vectorize = layout.contiguous() && can_vectorize({&t});
+            AccessRange rw[] = {t.access_range()};
 
             SushiRuntime::Graph::TaskMetadata meta;
             meta.name = name;
@@ -60,39 +67,43 @@ namespace SushiBLAS
             meta.op_id = op_id;
             for (size_t i = 0; i < params.size(); ++i) meta.set_param(i, params[i]);
 
-            engine.get_graph().add_task(meta, rw, rw,
-                [size, ptr, dtype = t.dtype, op_func, name](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
+            FusionInfo fusion = layout.contiguous() ? make_fusion_info(ptr, nullptr, nullptr, size, t.dtype) : FusionInfo{};
+
+            engine.add_task(meta, rw, rw,
+                [size, ptr, layout, vectorize, dtype = t.dtype, op_func, name](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
                 {
                     SB_LOG_INFO("{} Forward: {} elements", name, size);
                     return q.submit([&](sycl::handler& h) 
                     {
                         h.depends_on(deps);
+                        auto launch = [&](auto* p)
+                        {
+                            if constexpr (is_vector_element_v<std::remove_pointer_t<decltype(p)>>)
+                            {
+                                if (vectorize) return vector_for(h, size, p, op_func, p);
+                            }
+                            strided_for(h, layout, size, [=](const int64_t (&o)[1]) { p[o[0]] = op_func(p[o[0]]); });
+                        };
+
                         switch (dtype) 
                         {
-                            case Core::DataType::HALF:
-                                h.parallel_for(sycl::range<1>(size), [=, p = (sycl::half*)ptr](sycl::id<1> i) { p[i] = op_func(p[i]); });
-                                break;
-                            case Core::DataType::FLOAT32:
-                                h.parallel_for(sycl::range<1>(size), [=, p = (float*)ptr](sycl::id<1> i) { p[i] = op_func(p[i]); });
-                                break;
-                            case Core::DataType::FLOAT64:
-                                h.parallel_for(sycl::range<1>(size), [=, p = (double*)ptr](sycl::id<1> i) { p[i] = op_func(p[i]); });
-                                break;
-                            case Core::DataType::COMPLEX32:
-                                h.parallel_for(sycl::range<1>(size), [=, p = (std::complex<float>*)ptr](sycl::id<1> i) { p[i] = op_func(p[i]); });
-                                break;
-                            case Core::DataType::COMPLEX64:
-                                h.parallel_for(sycl::range<1>(size), [=, p = (std::complex<double>*)ptr](sycl::id<1> i) { p[i] = op_func(p[i]); });
-                                break;
+                            case Core::DataType::HALF:      launch((sycl::half*)ptr); break;
+                            case Core::DataType::FLOAT32:   launch((float*)ptr); break;
+                            case Core::DataType::FLOAT64:   launch((double*)ptr); break;
+                            case Core::DataType::COMPLEX32: launch((std::complex<float>*)ptr); break;
+                            case Core::DataType::COMPLEX64: launch((std::complex<double>*)ptr); break;
                             default: break;
                         }
                     });
-                });
+                }, fusion, {static_cast<uint64_t>(size)});
             return sycl::event();
         }
 
         /**
          * @brief Helper for nonlinear backward operations.
+         * 
+         * dy, x and dx can be views of any layout as long as their shapes match. 
+         * Contiguous aligned real tensors use vector_for().
          */
         template<typename Func>
         sycl::event execute_nonlinear_backward(Engine& engine, const Tensor& dy, const Tensor& x, Tensor& dx, const char* name, SushiRuntime::Graph::OpID op_id, Func&& op_func, const std::vector<float>& params = {}) 
@@ -103,8 +114,10 @@ namespace SushiBLAS
                        "Tensor data types must match for backward operation.");
 
             int64_t size = x.num_elements;
-            std::vector<void*> reads = {dy.storage->data_ptr, x.storage->data_ptr};
-            std::vector<void*> writes = {dx.storage->data_ptr};
+            StridedShape<3> layout = make_strided<3>({&dy, &x, &dx});
+            bool vectorize = layout.contiguous() && can_vectorize({&dy, &x, &dx});
+            AccessRange reads[] = {dy.access_range(), x.access_range()};
+            AccessRange writes[] = {dx.access_range()};
 
             SushiRuntime::Graph::TaskMetadata meta;
             meta.name = name;
@@ -112,34 +125,43 @@ namespace SushiBLAS
             meta.op_id = op_id;
             for (size_t i = 0; i < params.size(); ++i) meta.set_param(i, params[i]);
 
-            engine.get_graph().add_task(meta, reads, writes,
-                [size, pDY_raw = dy.storage->data_ptr, pX_raw = x.storage->data_ptr, pDX_raw = dx.storage->data_ptr, dtype = x.dtype, op_func, name](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
+            engine.add_task(meta, reads, writes,
+                [size, layout, vectorize, pDY_raw = dy.data(), pX_raw = x.data(), pDX_raw = dx.data(), dtype = x.dtype, op_func, name](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
                 {
                     SB_LOG_INFO("{} Backward: {} elements", name, size);
                     return q.submit([&](sycl::handler& h) 
                     {
                         h.depends_on(deps);
+                        auto launch = [&](auto* pdy, auto* px, auto* pdx)
+                        {
+                            if constexpr (is_vector_element_v<std::remove_pointer_t<decltype(pdx)>>)
+                            {
+                                if (vectorize) return vector_for(h, size, pdx, op_func, pdy, px);
+                            }
+                            strided_for(h, layout, size, [=](const int64_t (&o)[3]) { pdx[o[2]] = op_func(pdy[o[0]], px[o[1]]); });
+                        };
+
                         switch (dtype) 
                         {
                             case Core::DataType::HALF:
-                                h.parallel_for(sycl::range<1>(size), [=, pdy = (sycl::half*)pDY_raw, px = (sycl::half*)pX_raw, pdx = (sycl::half*)pDX_raw](sycl::id<1> i) { pdx[i] = op_func(pdy[i], px[i]); });
+                                launch((sycl::half*)pDY_raw, (sycl::half*)pX_raw, (sycl::half*)pDX_raw);
                                 break;
                             case Core::DataType::FLOAT32:
-                                h.parallel_for(sycl::range<1>(size), [=, pdy = (float*)pDY_raw, px = (float*)pX_raw, pdx = (float*)pDX_raw](sycl::id<1> i) { pdx[i] = op_func(pdy[i], px[i]); });
+                                launch((float*)pDY_raw, (float*)pX_raw, (float*)pDX_raw);
                                 break;
                             case Core::DataType::FLOAT64:
-                                h.parallel_for(sycl::range<1>(size), [=, pdy = (double*)pDY_raw, px = (double*)pX_raw, pdx = (double*)pDX_raw](sycl::id<1> i) { pdx[i] = op_func(pdy[i], px[i]); });
+                                launch((double*)pDY_raw, (double*)pX_raw, (double*)pDX_raw);
                                 break;
                             case Core::DataType::COMPLEX32:
-                                h.parallel_for(sycl::range<1>(size), [=, pdy = (std::complex<float>*)pDY_raw, px = (std::complex<float>*)pX_raw, pdx = (std::complex<float>*)pDX_raw](sycl::id<1> i) { pdx[i] = op_func(pdy[i], px[i]); });
+                                launch((std::complex<float>*)pDY_raw, (std::complex<float>*)pX_raw, (std::complex<float>*)pDX_raw);
                                 break;
                             case Core::DataType::COMPLEX64:
-                                h.parallel_for(sycl::range<1>(size), [=, pdy = (std::complex<double>*)pDY_raw, px = (std::complex<double>*)pX_raw, pdx = (std::complex<double>*)pDX_raw](sycl::id<1> i) { pdx[i] = op_func(pdy[i], px[i]); });
+                                launch((std::complex<double>*)pDY_raw, (std::complex<double>*)pX_raw, (std::complex<double>*)pDX_raw);
                                 break;
                             default: break;
                         }
                     });
-                });
+                }, {}, {static_cast<uint64_t>(size)});
             return sycl::event();
         }
 
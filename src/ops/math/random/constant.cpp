@@ -50,15 +50,15 @@ namespace SushiBLAS
 
         const int64_t size = t.num_elements;
         void* ptr = t.storage ? t.storage->data_ptr : nullptr;
-        std::vector<void*> reads = {};
-        std::vector<void*> writes = {};
-        if (ptr) writes.push_back(ptr);
+        std::vector<AccessRange> reads = {};
+        std::vector<AccessRange> writes = {};
+        if (ptr) writes.push_back(t.access_range());
 
         switch (t.dtype)
         {
             case Core::DataType::HALF:
             {
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [size, value, pT = t.data_as<sycl::half>()](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
                     {
                         SB_LOG_INFO("RandomOps: constant ({} elements, value: {:.4f})", size, value);
@@ -69,7 +69,7 @@ namespace SushiBLAS
             }
             case Core::DataType::FLOAT32:
             {
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [size, value, pT = t.data_as<float>()](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
                     {
                         SB_LOG_INFO("RandomOps: constant ({} elements, value: {:.4f})", size, value);
@@ -80,7 +80,7 @@ namespace SushiBLAS
             }
             case Core::DataType::FLOAT64:
             {
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [size, value, pT = t.data_as<double>()](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
                     {
                         SB_LOG_INFO("RandomOps: constant ({} elements, value: {:.4f})", size, value);
@@ -91,7 +91,7 @@ namespace SushiBLAS
             }
             case Core::DataType::COMPLEX32:
             {
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [size, value, pT = t.data_as<std::complex<float>>()](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
                     {
                         SB_LOG_INFO("RandomOps: constant complex32 ({} elements, value: {:.4f})", size, value);
@@ -102,7 +102,7 @@ namespace SushiBLAS
             }
             case Core::DataType::COMPLEX64:
             {
-                engine_.get_graph().add_task(meta, reads, writes,
+                engine_.add_task(meta, reads, writes,
                     [size, value, pT = t.data_as<std::complex<double>>()](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
                     {
                         SB_LOG_INFO("RandomOps: constant complex64 ({} elements, value: {:.4f})", size, value);
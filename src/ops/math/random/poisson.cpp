@@ -30,6 +30,7 @@
 
 #include <SushiBLAS/engine.hpp>
 #include <SushiBLAS/core/logger.hpp>
+#include <SushiBLAS/graph/profiler.hpp>
 #include <SushiBLAS/ops/math/random.hpp>
 #include <SushiRuntime/graph/task_types.hpp>
 #include "random_internal.hpp"
@@ -56,6 +57,7 @@ namespace SushiBLAS
                     oneapi::mkl::rng::skip_ahead(engine_obj, offset * size);
                     
                     auto ev = oneapi::mkl::rng::generate(oneapi::mkl::rng::poisson<std::int32_t>(lambda), engine_obj, size, tmp, deps);
+                    mark_first_kernel(ev);
                     
                     auto cast_ev = q.submit([&](sycl::handler& h) 
                     {
@@ -59,9 +59,9 @@ namespace SushiBLAS
             const int64_t size = t.num_elements;
             void* ptr = t.storage ? t.storage->data_ptr : nullptr;
             
-            std::vector<void*> reads = {};
-            std::vector<void*> writes = {};
-            if (ptr) writes.push_back(ptr);
+            std::vector<AccessRange> reads = {};
+            std::vector<AccessRange> writes = {};
+            if (ptr) writes.push_back(t.flat_access_range());
             
             SushiRuntime::Graph::TaskMetadata meta;
             meta.name = name;
@@ -78,7 +78,7 @@ namespace SushiBLAS
             meta.set_param(10, static_cast<double>(seed));
             meta.set_param(11, static_cast<double>(offset));
 
-            engine.get_graph().add_task(meta, reads, writes,
+            engine.add_task(meta, reads, writes,
                 [dtype=t.dtype, size, seed, offset, task_func, pT = ptr, name](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
                 {
                     SB_LOG_INFO("RandomOps: {} ({} elements, seed: {}, offset: {})", name, size, seed, offset);
@@ -48,16 +48,16 @@ namespace SushiBLAS
 
         const int64_t size = t.num_elements;
         void* ptr = t.storage ? t.storage->data_ptr : nullptr;
-        std::vector<void*> reads = {};
-        std::vector<void*> writes = {};
-        if (ptr) writes.push_back(ptr);
+        std::vector<AccessRange> reads = {};
+        std::vector<AccessRange> writes = {};
+        if (ptr) writes.push_back(t.access_range());
 
         const uint64_t seed = engine_.get_seed();
         const uint64_t offset = engine_.get_and_increment_rng_offset();
         meta.set_param(10, seed);
         meta.set_param(11, offset);
 
-        engine_.get_graph().add_task(meta, reads, writes,
+        engine_.add_task(meta, reads, writes,
             [size](sycl::queue& q, const std::vector<sycl::event>& deps) -> sycl::event 
             {
                 (void)q;
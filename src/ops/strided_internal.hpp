@@ -0,0 +1,232 @@
+/**************************************************************************/
+/* strided_internal.hpp                                                   */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <algorithm>
+#include <sycl/sycl.hpp>
+#include <SushiBLAS/tensor.hpp>
+#include <SushiBLAS/core/logger.hpp>
+
+namespace SushiBLAS 
+{
+    namespace Internal 
+    {
+        /**
+         * @brief The common shape of N operands and the strides of each one, in elements.
+         * 
+         * Elements are visited in row-major order of the shape. Each operand finds 
+         * its element through its own strides, so slices, transposes and broadcast 
+         * inputs are read and written in place.
+         */
+        template<int N>
+        struct StridedShape 
+        {
+            int32_t rank = 0;
+            int64_t shape[Core::MAX_TENSOR_RANK] = {};
+            int64_t strides[N][Core::MAX_TENSOR_RANK] = {};
+
+            /** @brief True if every operand is a dense array visited in memory order. */
+            bool contiguous() const 
+            {
+                if (rank != 1) return false;
+                for (int k = 0; k < N; ++k)
+                    if (strides[k][0] != 1) return false;
+                return true;
+            }
+
+            /**
+             * @brief Drop size 1 dimensions and merge dimensions that are dense for every operand.
+             * 
+             * A row slice of a matrix becomes one dimension, and a contiguous tensor 
+             * of any rank becomes a flat array. The rank is always at least 1.
+             */
+            void coalesce()
+            {
+                int32_t out = 0;
+                for (int d = 0; d < rank; ++d)
+                {
+                    if (shape[d] == 1) continue;
+
+                    bool merge = out > 0;
+                    for (int k = 0; k < N && merge; ++k)
+                        merge = strides[k][out - 1] == strides[k][d] * shape[d];
+
+                    if (merge)
+                    {
+                        shape[out - 1] *= shape[d];
+                        for (int k = 0; k < N; ++k) strides[k][out - 1] = strides[k][d];
+                        continue;
+                    }
+
+                    shape[out] = shape[d];
+                    for (int k = 0; k < N; ++k) strides[k][out] = strides[k][d];
+                    ++out;
+                }
+
+                if (out == 0)
+                {
+                    shape[0] = 1;
+                    for (int k = 0; k < N; ++k) strides[k][0] = 1;
+                    out = 1;
+                }
+                rank = out;
+            }
+        };
+
+        /**
+         * @brief Describe N operands that are visited element by element.
+         * 
+         * Operands with the same shape are indexed through their strides. Operands 
+         * whose shapes differ but that are all contiguous with the same number of 
+         * elements are treated as flat arrays, as before views were supported.
+         * @throws std::runtime_error If the shapes differ and an operand is not contiguous.
+         */
+        template<int N>
+        inline StridedShape<N> make_strided(const std::array<const Tensor*, N>& operands)
+        {
+            const Tensor& ref = *operands[0];
+
+            bool same_shape = true;
+            bool all_contiguous = true;
+            for (const Tensor* t : operands)
+            {
+                SB_THROW_IF(t->num_elements != ref.num_elements, 
+                            "Tensor sizes must match ({} vs {}).", t->num_elements, ref.num_elements);
+                same_shape = same_shape && t->rank == ref.rank && 
+                             std::equal(t->shape.begin(), t->shape.begin() + t->rank, ref.shape.begin());
+                all_contiguous = all_contiguous && t->is_contiguous() && t->layout == ref.layout;
+            }
+
+            StridedShape<N> s;
+            if (!same_shape || all_contiguous)
+            {
+                SB_THROW_IF(!all_contiguous, "Tensor shapes must match when an operand is a non-contiguous view.");
+                s.rank = 1;
+                s.shape[0] = ref.num_elements;
+                for (int k = 0; k < N; ++k) s.strides[k][0] = 1;
+                return s;
+            }
+
+            s.rank = ref.rank;
+            for (int d = 0; d < ref.rank; ++d)
+            {
+                s.shape[d] = ref.shape[d];
+                for (int k = 0; k < N; ++k) s.strides[k][d] = operands[k]->strides[d];
+            }
+            s.coalesce();
+            return s;
+        }
+
+        /**
+         * @brief Turns a row-major element index into the offsets of N operands.
+         * @tparam RANK The number of dimensions, fixed at compile time so the loop unrolls.
+         */
+        template<int RANK, int N>
+        struct StridedIndexer 
+        {
+            int64_t shape[RANK];
+            int64_t strides[N][RANK];
+
+            explicit StridedIndexer(const StridedShape<N>& s)
+            {
+                for (int d = 0; d < RANK; ++d)
+                {
+                    shape[d] = s.shape[d];
+                    for (int k = 0; k < N; ++k) strides[k][d] = s.strides[k][d];
+                }
+            }
+
+            inline void offsets(int64_t i, int64_t (&off)[N]) const 
+            {
+                for (int k = 0; k < N; ++k) off[k] = 0;
+
+                #pragma unroll
+                for (int d = RANK - 1; d > 0; --d)
+                {
+                    int64_t idx = i % shape[d];
+                    i /= shape[d];
+                    for (int k = 0; k < N; ++k) off[k] += idx * strides[k][d];
+                }
+                for (int k = 0; k < N; ++k) off[k] += i * strides[k][0];
+            }
+        };
+
+        /**
+         * @brief Launch body(offsets) once per element of a strided shape.
+         * 
+         * Contiguous operands use a flat index. Other shapes use a StridedIndexer of 
+         * the matching rank, so each view pays only for the dimensions it really has.
+         * @param h The command group handler.
+         * @param s The operands, from make_strided() or make_broadcast().
+         * @param size The number of elements.
+         * @param body Called with `const int64_t (&)[N]` holding one offset per operand.
+         */
+        template<int N, typename Body>
+        void strided_for(sycl::handler& h, const StridedShape<N>& s, int64_t size, Body body)
+        {
+            if (s.contiguous())
+            {
+                h.parallel_for(sycl::range<1>(size), [=](sycl::id<1> id) 
+                {
+                    int64_t off[N];
+                    for (int k = 0; k < N; ++k) off[k] = static_cast<int64_t>(id[0]);
+                    body(off);
+                });
+                return;
+            }
+
+            auto launch = [&](auto indexer)
+            {
+                h.parallel_for(sycl::range<1>(size), [=](sycl::id<1> id) 
+                {
+                    int64_t off[N];
+                    indexer.offsets(static_cast<int64_t>(id[0]), off);
+                    body(off);
+                });
+            };
+
+            static_assert(Core::MAX_TENSOR_RANK == 6, "strided_for() handles ranks 1 to 6.");
+            switch (s.rank) 
+            {
+                case 1: launch(StridedIndexer<1, N>(s)); break;
+                case 2: launch(StridedIndexer<2, N>(s)); break;
+                case 3: launch(StridedIndexer<3, N>(s)); break;
+                case 4: launch(StridedIndexer<4, N>(s)); break;
+                case 5: launch(StridedIndexer<5, N>(s)); break;
+                case 6: launch(StridedIndexer<6, N>(s)); break;
+                default: break;
+            }
+        }
+
+    } // namespace Internal
+} // namespace SushiBLAS
@@ -0,0 +1,134 @@
+/**************************************************************************/
+/* vector_internal.hpp                                                    */
+/**************************************************************************/
+/*                          This file is part of:                         */
+/*                                SushiBLAS                               */
+/*                https://github.com/SushiSystems/SushiBLAS               */
+/*                         https://sushisystems.io                        */
+/**************************************************************************/
+/* Copyright (c) 2026-present  Mustafa Garip & Sushi Systems              */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+#include <initializer_list>
+#include <sycl/sycl.hpp>
+#include <SushiBLAS/tensor.hpp>
+#include <SushiRuntime/core/common.hpp>
+
+namespace SushiBLAS 
+{
+    namespace Internal 
+    {
+        /** @brief Bytes each work item reads or writes per operand: one cache line, e.g. one AVX-512 register. */
+        inline constexpr size_t VECTOR_BYTES = 64;
+
+        /** @brief Work group size of vectorised kernels. */
+        inline constexpr size_t VECTOR_GROUP_SIZE = 256;
+
+        /** @brief Element types that fit in a sycl::vec. */
+        template<typename T>
+        inline constexpr bool is_vector_element_v = std::is_same_v<T, sycl::half> || std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+        /** @brief Lanes of the sycl::vec a work item handles (16 for float and half, 8 for double). */
+        template<typename T>
+        inline constexpr int vector_lanes_v = static_cast<int>(std::min<size_t>(16, VECTOR_BYTES / sizeof(T)));
+
+        /** @brief True if a pointer is aligned well enough for vector loads and stores. */
+        inline bool vector_aligned(const void* ptr)
+        {
+            return ptr != nullptr && reinterpret_cast<uintptr_t>(ptr) % SushiRuntime::Core::DEFAULT_ALIGNMENT == 0;
+        }
+
+        /**
+         * @brief True if the tensors can use vector_for().
+         * 
+         * Every tensor must be contiguous, aligned (see Tensor::is_aligned()) and of 
+         * a real floating point type. Callers must also check that the operands are 
+         * visited in the same order, e.g. with StridedShape::contiguous().
+         */
+        inline bool can_vectorize(std::initializer_list<const Tensor*> tensors)
+        {
+            for (const Tensor* t : tensors)
+            {
+                if (!t->storage || t->storage->data_ptr == nullptr || t->num_elements == 0) return false;
+                if (t->dtype != Core::DataType::HALF && t->dtype != Core::DataType::FLOAT32 && t->dtype != Core::DataType::FLOAT64) return false;
+                if (!t->is_contiguous() || !t->is_aligned()) return false;
+            }
+            return true;
+        }
+
+        /** @brief Apply a scalar operation to each lane of sycl::vec inputs. */
+        template<typename T, int L, typename Func, typename... V>
+        inline sycl::vec<T, L> apply_lanes(const Func& op, const V&... in)
+        {
+            sycl::vec<T, L> r;
+            #pragma unroll
+            for (int l = 0; l < L; ++l)
+                r[l] = op(in[l]...);
+            return r;
+        }
+
+        /**
+         * @brief Launch out[i] = op(in[i]...) with one sycl::vec chunk per work item.
+         * 
+         * Each work item loads vector_lanes_v<T> elements of every input with one 
+         * vector load, applies op to each lane and stores the chunk. The last work 
+         * item runs a scalar tail loop when size is not a multiple of the lanes.
+         * Pointers must pass vector_aligned(). out may be one of the inputs.
+         * @param h The command group handler.
+         * @param size The number of elements.
+         * @param out The output array.
+         * @param op The scalar operation, the same one the strided kernel uses.
+         * @param in The input arrays.
+         */
+        template<typename T, typename Func, typename... In>
+        void vector_for(sycl::handler& h, int64_t size, T* out, Func op, const In*... in)
+        {
+            constexpr int L = vector_lanes_v<T>;
+            using Vec = sycl::vec<T, L>;
+
+            size_t items = (static_cast<size_t>(size) + L - 1) / L;
+            size_t global = (items + VECTOR_GROUP_SIZE - 1) / VECTOR_GROUP_SIZE * VECTOR_GROUP_SIZE;
+
+            h.parallel_for(sycl::nd_range<1>(global, VECTOR_GROUP_SIZE), [=](sycl::nd_item<1> item) 
+            {
+                size_t g = item.get_global_id(0);
+                if (g >= items) return;
+
+                int64_t first = static_cast<int64_t>(g) * L;
+                if (first + L <= size)
+                {
+                    reinterpret_cast<Vec*>(out)[g] = apply_lanes<T, L>(op, reinterpret_cast<const Vec*>(in)[g]...);
+                    return;
+                }
+
+                for (int64_t i = first; i < size; ++i)
+                    out[i] = op(in[i]...);
+            });
+        }
+
+    } // namespace Internal
+} // namespace SushiBLAS
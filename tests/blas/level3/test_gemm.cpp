@@ -86,3 +86,79 @@ TEST_F(GEMMTest, SimpleGEMMColumnMajor)
     // Expected Memory: [19, 43, 22, 50]
     verify_tensor(C, {19, 43, 22, 50});
 }
+
+TEST_F(GEMMTest, EpilogueBiasRelu) 
+{
+    const int N = 2;
+    auto A = engine->create_tensor({N, N});
+    auto B = engine->create_tensor({N, N});
+    auto C = engine->create_tensor({N, N});
+    auto bias = engine->create_tensor({N});
+
+    fill_tensor(A, {1, 2, 3, 4});
+    fill_tensor(B, {1, 0, 0, 1});
+    fill_tensor(bias, {-2, 1});
+
+    sb::GemmEpilogue epilogue;
+    epilogue.bias = &bias;
+    epilogue.activation = sb::Core::Activation::RELU;
+
+    engine->blas().gemm(A, B, C, epilogue);
+    engine->execute().wait();
+
+    // A + bias per column: [[-1, 3], [1, 5]] -> relu
+    verify_tensor(C, {0, 3, 1, 5});
+}
+
+TEST_F(GEMMTest, EpilogueRejectsStridedVector) 
+{
+    const int N = 4;
+    auto A = engine->create_tensor({N, N});
+    auto B = engine->create_tensor({N, N});
+    auto C = engine->create_tensor({N, N});
+    auto M = engine->create_tensor({2, 2});
+
+    // a transposed 2x2 matrix has N elements with the right dtype, but is not contiguous
+    auto strided = M.transpose(0, 1);
+    ASSERT_EQ(strided.num_elements, N);
+    ASSERT_FALSE(strided.is_contiguous());
+
+    sb::GemmEpilogue epilogue;
+    epilogue.bias = &strided;
+
+    EXPECT_THROW(engine->blas().gemm(A, B, C, epilogue), std::runtime_error);
+
+    // a dense vector of the same length is accepted
+    auto dense = engine->create_tensor({N});
+    epilogue.bias = &dense;
+    EXPECT_NO_THROW(engine->blas().gemm(A, B, C, epilogue));
+    engine->execute().wait();
+}
+
+TEST_F(GEMMTest, EpilogueScaleBiasColumnMajor) 
+{
+    reinit_engine(sb::Core::Layout::COLUMN_MAJOR);
+
+    const int N = 2;
+    auto A = engine->create_tensor({N, N});
+    auto B = engine->create_tensor({N, N});
+    auto C = engine->create_tensor({N, N});
+    auto scale = engine->create_tensor({N});
+    auto bias = engine->create_tensor({N});
+
+    // A: [[1, 2], [3, 4]], B: identity
+    fill_tensor(A, {1, 3, 2, 4});
+    fill_tensor(B, {1, 0, 0, 1});
+    fill_tensor(scale, {2, 10});
+    fill_tensor(bias, {1, -1});
+
+    sb::GemmEpilogue epilogue;
+    epilogue.scale = &scale;
+    epilogue.bias = &bias;
+
+    engine->blas().gemm(A, B, C, epilogue);
+    engine->execute().wait();
+
+    // [[1*2+1, 2*10-1], [3*2+1, 4*10-1]] -> Column-major: [3, 7, 19, 39]
+    verify_tensor(C, {3, 7, 19, 39});
+}
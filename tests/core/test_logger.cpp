@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <SushiBLAS/SushiBLAS.h>
+
+namespace Log = sb::Core::Detail;
+
+TEST(LoggerTest, FormatsStoredArguments)
+{
+    Log::LogRecord rec;
+    std::string name = "gemm";
+    Log::fill_record(rec, sb::Core::LogType::INFO, sb::Core::LogCategory::BLAS, std::source_location::current(), 
+                     "{} {}x{} took {:.2f} ms ({{ok}})", name, int64_t{4}, size_t{8}, 1.5);
+
+    // the string is copied, so the record outlives the argument
+    name = "changed";
+
+    EXPECT_EQ(rec.arg_count, 4u);
+    EXPECT_EQ(Log::format_message(rec), "gemm 4x8 took 1.50 ms ({ok})");
+}
+
+TEST(LoggerTest, PositionalArguments)
+{
+    Log::LogRecord rec;
+    Log::fill_record(rec, sb::Core::LogType::WARN, sb::Core::LogCategory::CORE, std::source_location::current(), 
+                     "{1} before {0}", "b", 'a');
+
+    EXPECT_EQ(Log::format_message(rec), "a before b");
+}
+
+TEST(LoggerTest, CategoryFromPath)
+{
+    static_assert(Log::category_of("src/ops/blas/level3/gemm.cpp") == sb::Core::LogCategory::BLAS);
+    static_assert(Log::category_of("src\\ops\\math\\elementwise\\add.cpp") == sb::Core::LogCategory::MATH);
+    static_assert(Log::category_of("src/graph/fusion.cpp") == sb::Core::LogCategory::GRAPH);
+    static_assert(Log::category_of("src/engine.cpp") == sb::Core::LogCategory::CORE);
+}
+
+TEST(LoggerTest, CategoryLevels)
+{
+    sb::Core::LogType before = sb::Core::get_log_level(sb::Core::LogCategory::BLAS);
+
+    sb::Core::set_log_level(sb::Core::LogCategory::BLAS, sb::Core::LogType::ERR);
+    EXPECT_EQ(sb::Core::get_log_level(sb::Core::LogCategory::BLAS), sb::Core::LogType::ERR);
+    EXPECT_EQ(sb::Core::get_log_level(sb::Core::LogCategory::MATH), before);
+
+    sb::Core::set_log_level(sb::Core::LogCategory::BLAS, before);
+}
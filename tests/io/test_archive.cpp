@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <fstream>
+#include <filesystem>
+#include <SushiBLAS/SushiBLAS.h>
+#include "../test_common.hpp"
+
+class ArchiveTest : public SushiBLASTest 
+{
+    protected:
+        std::string path = (std::filesystem::temp_directory_path() / "sushiblas_test.sar").string();
+
+        void TearDown() override 
+        {
+            SushiBLASTest::TearDown();
+            std::filesystem::remove(path);
+        }
+};
+
+TEST_F(ArchiveTest, SaveAndLoadSelected)
+{
+    auto w = engine->create_tensor({2, 2});
+    auto b = engine->create_tensor({3});
+    auto d = engine->create_tensor({2}, sb::Core::DataType::FLOAT64);
+    fill_tensor(w, {1.0f, 2.0f, 3.0f, 4.0f});
+    fill_tensor(b, {5.0f, 6.0f, 7.0f});
+    fill_tensor<double>(d, {8.0, 9.0});
+
+    engine->io().save_archive({{"w", w}, {"b", b}, {"d", d}}, path);
+
+    auto archive = engine->io().open_archive(path);
+    EXPECT_EQ(archive.names(), (std::vector<std::string>{"w", "b", "d"}));
+    EXPECT_TRUE(archive.contains("b"));
+    EXPECT_FALSE(archive.contains("x"));
+    EXPECT_EQ(archive.entry("b").offset % sb::ARCHIVE_ALIGNMENT, 0u);
+
+    auto b2 = archive.load("b");
+    EXPECT_EQ(b2.rank, 1);
+    verify_tensor(b2, {5.0f, 6.0f, 7.0f});
+
+    auto d2 = archive.load("d");
+    EXPECT_EQ(d2.dtype, sb::Core::DataType::FLOAT64);
+    verify_tensor<double>(d2, {8.0, 9.0});
+
+    auto w2 = archive.map("w");
+    EXPECT_EQ(w2.shape[0], 2);
+    verify_tensor(w2, {1.0f, 2.0f, 3.0f, 4.0f});
+
+    auto w3 = engine->create_tensor({2, 2});
+    archive.load_into("w", w3);
+    verify_tensor(w3, {1.0f, 2.0f, 3.0f, 4.0f});
+}
+
+TEST_F(ArchiveTest, DetectsCorruption)
+{
+    auto a = engine->create_tensor({4});
+    fill_tensor(a, {1.0f, 2.0f, 3.0f, 4.0f});
+    engine->io().save_archive({{"a", a}}, path);
+
+    uint64_t offset = engine->io().open_archive(path).entry("a").offset;
+    {
+        std::fstream f(path, std::ios::binary | std::ios::in | std::ios::out);
+        f.seekp(static_cast<std::streamoff>(offset));
+        float bad = 42.0f;
+        f.write(reinterpret_cast<const char*>(&bad), sizeof(float));
+    }
+
+    auto archive = engine->io().open_archive(path);
+    EXPECT_THROW(archive.load("a"), std::runtime_error);
+    EXPECT_NO_THROW(archive.load("a", sr::Memory::AllocStrategy::SHARED, false));
+}
+
+TEST_F(ArchiveTest, RejectsDuplicateNames)
+{
+    auto a = engine->create_tensor({4});
+    EXPECT_THROW(engine->io().save_archive({{"a", a}, {"a", a}}, path), std::runtime_error);
+}
+
+TEST_F(ArchiveTest, RejectsShapeThatDoesNotMatchPayload)
+{
+    auto a = engine->create_tensor({4});
+    fill_tensor(a, {1.0f, 2.0f, 3.0f, 4.0f});
+    engine->io().save_archive({{"a", a}}, path);
+
+    // the first dimension of the first record follows the 24 byte header and four int32 fields
+    {
+        std::fstream f(path, std::ios::binary | std::ios::in | std::ios::out);
+        f.seekp(24 + 4 * sizeof(int32_t));
+        int64_t huge = 1 << 20;
+        f.write(reinterpret_cast<const char*>(&huge), sizeof(int64_t));
+    }
+
+    EXPECT_THROW(engine->io().open_archive(path), std::runtime_error);
+}
+
+TEST_F(ArchiveTest, RejectsStridedView)
+{
+    auto w = engine->create_tensor({2, 3});
+    fill_tensor(w, {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f});
+
+    EXPECT_THROW(engine->io().save_archive({{"wt", w.transpose(0, 1)}}, path), std::runtime_error);
+    EXPECT_THROW(engine->io().save_archive({{"col", w.slice(1, 1, 2)}}, path), std::runtime_error);
+}
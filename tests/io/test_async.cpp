@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <filesystem>
+#include <SushiBLAS/SushiBLAS.h>
+#include "../test_common.hpp"
+
+class AsyncIOTest : public SushiBLASTest 
+{
+    protected:
+        std::string path = (std::filesystem::temp_directory_path() / "sushiblas_test_async.sushi").string();
+
+        void TearDown() override 
+        {
+            SushiBLASTest::TearDown();
+            std::filesystem::remove(path);
+        }
+};
+
+TEST_F(AsyncIOTest, SaveSnapshotsBeforeLaterWrites)
+{
+    auto a = engine->create_tensor({4});
+    fill_tensor(a, {1.0f, 2.0f, 3.0f, 4.0f});
+
+    auto saved = engine->io().save_async(a, path);
+    engine->blas().scal(10.0f, a);
+    engine->execute().wait();
+    saved.get();
+
+    auto b = engine->create_tensor({4});
+    engine->io().load(b, path);
+    verify_tensor(b, {1.0f, 2.0f, 3.0f, 4.0f});
+    verify_tensor(a, {10.0f, 20.0f, 30.0f, 40.0f});
+}
+
+TEST_F(AsyncIOTest, LoadOrdersWithLaterTasks)
+{
+    auto a = engine->create_tensor({4});
+    fill_tensor(a, {1.0f, 2.0f, 3.0f, 4.0f});
+    engine->io().save(a, path);
+
+    auto b = engine->create_tensor({4});
+    auto loaded = engine->io().load_async(b, path);
+    engine->blas().scal(2.0f, b);
+    engine->execute().wait();
+    loaded.get();
+
+    verify_tensor(b, {2.0f, 4.0f, 6.0f, 8.0f});
+}
+
+TEST_F(AsyncIOTest, MissingFileSetsError)
+{
+    auto b = engine->create_tensor({4});
+    fill_tensor(b, {1.0f, 2.0f, 3.0f, 4.0f});
+    auto loaded = engine->io().load_async(b, path + ".missing");
+    engine->execute().wait();
+
+    EXPECT_THROW(loaded.get(), std::runtime_error);
+
+    // a failed read must not overwrite the tensor
+    verify_tensor(b, {1.0f, 2.0f, 3.0f, 4.0f});
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <fstream>
+#include <filesystem>
+#include <SushiBLAS/SushiBLAS.h>
+#include "../test_common.hpp"
+
+class MapTest : public SushiBLASTest 
+{
+    protected:
+        std::string path = (std::filesystem::temp_directory_path() / "sushiblas_test_map.sushi").string();
+
+        void TearDown() override 
+        {
+            SushiBLASTest::TearDown();
+            std::filesystem::remove(path);
+        }
+};
+
+TEST_F(MapTest, ReadOnly)
+{
+    auto a = engine->create_tensor({2, 3});
+    fill_tensor(a, {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f});
+    engine->io().save(a, path);
+
+    auto m = engine->io().map(path);
+
+    EXPECT_EQ(m.rank, 2);
+    EXPECT_EQ(m.shape[0], 2);
+    EXPECT_EQ(m.shape[1], 3);
+    EXPECT_EQ(m.storage->strategy, sr::Memory::AllocStrategy::HOST);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(m.data()) % 4096, 0u);
+    verify_tensor(m, {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f});
+}
+
+TEST_F(MapTest, CopyOnWriteKeepsFile)
+{
+    auto a = engine->create_tensor({4});
+    fill_tensor(a, {1.0f, 2.0f, 3.0f, 4.0f});
+    engine->io().save(a, path);
+
+    {
+        auto m = engine->io().map(path, sb::MapMode::COPY_ON_WRITE);
+        fill_tensor(m, {9.0f, 9.0f, 9.0f, 9.0f});
+        verify_tensor(m, {9.0f, 9.0f, 9.0f, 9.0f});
+    }
+
+    auto b = engine->create_tensor({4});
+    engine->io().load(b, path);
+    verify_tensor(b, {1.0f, 2.0f, 3.0f, 4.0f});
+}
+
+TEST_F(MapTest, RejectsBadShape)
+{
+    auto a = engine->create_tensor({4});
+    fill_tensor(a, {1.0f, 2.0f, 3.0f, 4.0f});
+    engine->io().save(a, path);
+
+    // the first dimension follows the magic, the version and the rank
+    auto write_dim = [&](int64_t dim)
+    {
+        std::fstream f(path, std::ios::binary | std::ios::in | std::ios::out);
+        f.seekp(16);
+        f.write(reinterpret_cast<const char*>(&dim), sizeof(int64_t));
+    };
+
+    write_dim(-4);
+    EXPECT_THROW(engine->io().map(path), std::runtime_error);
+
+    // large enough that elements * element_size wraps around
+    write_dim(int64_t(1) << 62);
+    EXPECT_THROW(engine->io().map(path), std::runtime_error);
+}
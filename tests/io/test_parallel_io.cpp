@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <filesystem>
+#include <SushiBLAS/SushiBLAS.h>
+#include "../test_common.hpp"
+
+class ParallelIOTest : public SushiBLASTest 
+{
+    protected:
+        std::string path = (std::filesystem::temp_directory_path() / "sushiblas_test_parallel.sushi").string();
+
+        void TearDown() override 
+        {
+            SushiBLASTest::TearDown();
+            std::filesystem::remove(path);
+        }
+
+        /** @brief Save and load a tensor whose size is not a multiple of the chunk or block size. */
+        void round_trip()
+        {
+            const int N = 10000;
+            std::vector<float> data(N);
+            for (int i = 0; i < N; ++i) data[i] = static_cast<float>(i) * 0.5f;
+
+            auto a = engine->create_tensor({N});
+            fill_tensor(a, data);
+            engine->io().save(a, path);
+
+            auto b = engine->create_tensor({N});
+            engine->io().load(b, path);
+            verify_tensor(b, data);
+        }
+};
+
+TEST_F(ParallelIOTest, SmallChunks)
+{
+    sb::IOOptions options;
+    options.chunk_bytes = 4096;
+    options.threads = 4;
+    engine->parallel_io().set_options(options);
+
+    round_trip();
+}
+
+TEST_F(ParallelIOTest, DirectIO)
+{
+    sb::IOOptions options;
+    options.chunk_bytes = 8192;
+    options.threads = 3;
+    options.direct = true;
+    engine->parallel_io().set_options(options);
+
+    // falls back to the page cache where the file system has no direct IO
+    round_trip();
+}
+
+TEST_F(ParallelIOTest, DeviceStorage)
+{
+    sb::IOOptions options;
+    options.chunk_bytes = 4096;
+    engine->parallel_io().set_options(options);
+
+    const int N = 3000;
+    std::vector<float> data(N, 1.5f);
+    auto a = engine->create_tensor({N});
+    fill_tensor(a, data);
+    engine->io().save(a, path);
+
+    auto d = engine->create_tensor({N}, sr::Memory::AllocStrategy::DEVICE);
+    engine->io().load(d, path);
+
+    auto b = engine->create_tensor({N});
+    engine->blas().copy(d, b);
+    engine->execute().wait();
+    verify_tensor(b, data);
+}
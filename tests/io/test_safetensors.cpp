@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <fstream>
+#include <filesystem>
+#include <SushiBLAS/SushiBLAS.h>
+#include "../test_common.hpp"
+
+class SafeTensorsTest : public SushiBLASTest 
+{
+    protected:
+        std::string path = (std::filesystem::temp_directory_path() / "sushiblas_test.safetensors").string();
+
+        void TearDown() override 
+        {
+            SushiBLASTest::TearDown();
+            std::filesystem::remove(path);
+        }
+};
+
+TEST_F(SafeTensorsTest, RoundTripIsZeroCopy)
+{
+    auto w = engine->create_tensor({2, 3});
+    auto d = engine->create_tensor({2}, sb::Core::DataType::FLOAT64);
+    fill_tensor(w, {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f});
+    fill_tensor<double>(d, {7.0, 8.0});
+
+    engine->io().save_safetensors({{"w", w}, {"d", d}}, path, {{"format", "pt"}});
+
+    auto file = engine->io().open_safetensors(path);
+    EXPECT_EQ(file.metadata().at("format"), "pt");
+    EXPECT_TRUE(file.contains("w"));
+    EXPECT_TRUE(file.contains("d"));
+
+    auto w2 = file.get("w");
+    EXPECT_EQ(w2.rank, 2);
+    EXPECT_EQ(w2.shape[1], 3);
+    EXPECT_EQ(w2.storage->strategy, sr::Memory::AllocStrategy::HOST);
+    EXPECT_EQ(w2.storage->allocator, nullptr);
+    verify_tensor(w2, {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f});
+
+    auto d2 = file.get("d");
+    EXPECT_EQ(d2.dtype, sb::Core::DataType::FLOAT64);
+    verify_tensor<double>(d2, {7.0, 8.0});
+
+    auto copy = file.load("w");
+    EXPECT_NE(copy.storage->allocator, nullptr);
+    verify_tensor(copy, {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f});
+}
+
+TEST_F(SafeTensorsTest, ReadsForeignHeader)
+{
+    // a header as written by other tools: unsorted keys, spaces and an unsupported dtype
+    std::string header = R"({"b": {"dtype": "I64", "shape": [1], "data_offsets": [8, 16]}, )"
+                         R"("a": {"shape": [2], "dtype": "F32", "data_offsets": [0, 8]}})";
+    while (header.size() % 8) header += ' ';
+
+    uint64_t n = header.size();
+    float a[2] = {1.5f, -2.5f};
+    int64_t b = 7;
+    {
+        std::ofstream ofs(path, std::ios::binary);
+        ofs.write(reinterpret_cast<const char*>(&n), 8);
+        ofs.write(header.data(), header.size());
+        ofs.write(reinterpret_cast<const char*>(a), sizeof(a));
+        ofs.write(reinterpret_cast<const char*>(&b), sizeof(b));
+    }
+
+    auto file = engine->io().open_safetensors(path);
+    EXPECT_EQ(file.names(), std::vector<std::string>{"a"});
+    EXPECT_EQ(file.skipped(), std::vector<std::string>{"b"});
+    verify_tensor(file.get("a"), {1.5f, -2.5f});
+}
+
+TEST_F(SafeTensorsTest, RejectsStridedView)
+{
+    auto w = engine->create_tensor({2, 3});
+    fill_tensor(w, {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f});
+
+    EXPECT_THROW(engine->io().save_safetensors({{"wt", w.transpose(0, 1)}}, path), std::runtime_error);
+    EXPECT_THROW(engine->io().save_safetensors({{"col", w.slice(1, 1, 2)}}, path), std::runtime_error);
+}
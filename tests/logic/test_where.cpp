@@ -19,3 +19,18 @@ TEST_F(WhereTest, FloatForward)
     
     verify_tensor(c, {1.00000f, 20.00000f, 3.00000f, 40.00000f});
 }
+
+TEST_F(WhereTest, TransposedInput) 
+{
+    auto cond = engine->create_tensor({2, 2});
+    auto a = engine->create_tensor({2, 2});
+    auto b = engine->create_tensor({2, 2});
+    auto c = engine->create_tensor({2, 2});
+    fill_tensor(cond, {1.0f, 0.0f, 0.0f, 1.0f});
+    fill_tensor(a, {1.0f, 2.0f, 3.0f, 4.0f});
+    fill_tensor(b, {10.0f, 20.0f, 30.0f, 40.0f});
+    engine->logic().where(cond, a.transpose(0, 1), b, c);
+    engine->execute().wait();
+    
+    verify_tensor(c, {1.00000f, 20.00000f, 30.00000f, 4.00000f});
+}
@@ -18,3 +18,79 @@ TEST_F(AddTest, FloatForward)
     
     verify_tensor(c, {3.00000f, 2.50000f, 1.00000f, -1.00000f});
 }
+
+TEST_F(AddTest, BroadcastBiasRow) 
+{
+    auto x = engine->create_tensor({2, 3});
+    auto bias = engine->create_tensor({3});
+    auto y = engine->create_tensor({2, 3});
+    fill_tensor(x, {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f});
+    fill_tensor(bias, {10.0f, 20.0f, 30.0f});
+    
+    engine->elementwise().add(x, bias, y);
+    engine->execute().wait();
+    
+    verify_tensor(y, {11.0f, 22.0f, 33.0f, 14.0f, 25.0f, 36.0f});
+}
+
+TEST_F(AddTest, BroadcastShapeMismatch) 
+{
+    auto x = engine->create_tensor({2, 3});
+    auto b = engine->create_tensor({2});
+    auto y = engine->create_tensor({2, 3});
+    
+    EXPECT_THROW(engine->elementwise().add(x, b, y), std::runtime_error);
+}
+
+TEST_F(AddTest, TransposedInput) 
+{
+    auto a = engine->create_tensor({2, 3});
+    auto b = engine->create_tensor({3, 2});
+    auto c = engine->create_tensor({3, 2});
+    fill_tensor(a, {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f});
+    fill_tensor(b, {10.0f, 10.0f, 10.0f, 10.0f, 10.0f, 10.0f});
+    
+    engine->elementwise().add(a.transpose(0, 1), b, c);
+    engine->execute().wait();
+    
+    verify_tensor(c, {11.0f, 14.0f, 12.0f, 15.0f, 13.0f, 16.0f});
+}
+
+TEST_F(AddTest, ColumnSliceOutput) 
+{
+    auto a = engine->create_tensor({2, 2});
+    auto b = engine->create_tensor({2, 2});
+    auto c = engine->create_tensor({2, 4});
+    fill_tensor(a, {1.0f, 2.0f, 3.0f, 4.0f});
+    fill_tensor(b, {10.0f, 20.0f, 30.0f, 40.0f});
+    fill_tensor(c, {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
+    
+    auto inner = c.slice(1, 1, 3);
+    engine->elementwise().add(a, b, inner);
+    engine->execute().wait();
+    
+    verify_tensor(c, {0.0f, 11.0f, 22.0f, 0.0f, 0.0f, 33.0f, 44.0f, 0.0f});
+}
+
+TEST_F(AddTest, VectorisedWithTail) 
+{
+    const int N = 1027;
+    auto a = engine->create_tensor({N});
+    auto b = engine->create_tensor({N});
+    auto c = engine->create_tensor({N});
+    
+    std::vector<float> va(N), vb(N), expected(N);
+    for (int i = 0; i < N; ++i)
+    {
+        va[i] = static_cast<float>(i);
+        vb[i] = 0.5f * static_cast<float>(i);
+        expected[i] = 1.5f * static_cast<float>(i);
+    }
+    fill_tensor(a, va);
+    fill_tensor(b, vb);
+    
+    engine->elementwise().add(a, b, c);
+    engine->execute().wait();
+    
+    verify_tensor(c, expected);
+}
@@ -0,0 +1,22 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <SushiBLAS/SushiBLAS.h>
+#include "../../test_common.hpp"
+
+class AddcdivTest : public SushiBLASTest {};
+
+TEST_F(AddcdivTest, FloatForward) 
+{
+    auto input = engine->create_tensor({4});
+    auto t1 = engine->create_tensor({4});
+    auto t2 = engine->create_tensor({4});
+    auto out = engine->create_tensor({4});
+    fill_tensor(input, {1.0f, 2.0f, 3.0f, 4.0f});
+    fill_tensor(t1, {2.0f, 1.0f, 4.0f, -3.0f});
+    fill_tensor(t2, {4.0f, 2.0f, -1.0f, 2.0f});
+    
+    engine->elementwise().addcdiv(input, t1, t2, 2.0f, out);
+    engine->execute().wait();
+    
+    verify_tensor(out, {2.00000f, 3.00000f, -5.00000f, 1.00000f});
+}
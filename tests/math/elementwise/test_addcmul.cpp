@@ -0,0 +1,37 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <SushiBLAS/SushiBLAS.h>
+#include "../../test_common.hpp"
+
+class AddcmulTest : public SushiBLASTest {};
+
+TEST_F(AddcmulTest, FloatForward) 
+{
+    auto input = engine->create_tensor({4});
+    auto t1 = engine->create_tensor({4});
+    auto t2 = engine->create_tensor({4});
+    auto out = engine->create_tensor({4});
+    fill_tensor(input, {1.0f, 2.0f, 3.0f, 4.0f});
+    fill_tensor(t1, {2.0f, 0.5f, 4.0f, -1.5f});
+    fill_tensor(t2, {1.0f, 2.0f, -1.0f, 2.0f});
+    
+    engine->elementwise().addcmul(input, t1, t2, 0.5f, out);
+    engine->execute().wait();
+    
+    verify_tensor(out, {2.00000f, 2.50000f, 1.00000f, 2.50000f});
+}
+
+TEST_F(AddcmulTest, InPlace) 
+{
+    auto input = engine->create_tensor({4});
+    auto t1 = engine->create_tensor({4});
+    auto t2 = engine->create_tensor({4});
+    fill_tensor(input, {1.0f, 2.0f, 3.0f, 4.0f});
+    fill_tensor(t1, {1.0f, 1.0f, 1.0f, 1.0f});
+    fill_tensor(t2, {1.0f, 2.0f, 3.0f, 4.0f});
+    
+    engine->elementwise().addcmul(input, t1, t2, 2.0f, input);
+    engine->execute().wait();
+    
+    verify_tensor(input, {3.00000f, 6.00000f, 9.00000f, 12.00000f});
+}
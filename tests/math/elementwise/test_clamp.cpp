@@ -15,3 +15,16 @@ TEST_F(ClampTest, FloatForward)
     
     verify_tensor(t, {1.00000f, 1.50000f, -1.50000f, 0.50000f});
 }
+
+TEST_F(ClampTest, OutOfPlace) 
+{
+    auto in = engine->create_tensor({4});
+    auto out = engine->create_tensor({4});
+    fill_tensor(in, {1.0f, 2.0f, -3.0f, 0.5f});
+    
+    engine->elementwise().clamp(in, out, -1.5f, 1.5f);
+    engine->execute().wait();
+    
+    verify_tensor(out, {1.00000f, 1.50000f, -1.50000f, 0.50000f});
+    verify_tensor(in, {1.0f, 2.0f, -3.0f, 0.5f});
+}
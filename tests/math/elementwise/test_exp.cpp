@@ -15,3 +15,16 @@ TEST_F(ExpTest, FloatForward)
     
     verify_tensor(t, {2.71828f, 7.38906f, 0.04979f, 1.64872f});
 }
+
+TEST_F(ExpTest, OutOfPlace) 
+{
+    auto in = engine->create_tensor({4});
+    auto out = engine->create_tensor({4});
+    fill_tensor(in, {1.0f, 2.0f, -3.0f, 0.5f});
+    
+    engine->elementwise().exp(in, out);
+    engine->execute().wait();
+    
+    verify_tensor(out, {2.71828f, 7.38906f, 0.04979f, 1.64872f});
+    verify_tensor(in, {1.0f, 2.0f, -3.0f, 0.5f});
+}
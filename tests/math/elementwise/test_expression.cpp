@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <SushiBLAS/SushiBLAS.h>
+#include "../../test_common.hpp"
+
+class ExpressionTest : public SushiBLASTest {};
+
+TEST_F(ExpressionTest, ChainIsOneTask) 
+{
+    auto a = engine->create_tensor({4});
+    auto b = engine->create_tensor({4});
+    auto c = engine->create_tensor({4});
+    auto out = engine->create_tensor({4});
+    fill_tensor(a, {1.0f, 2.0f, -3.0f, 0.5f});
+    fill_tensor(b, {2.0f, 0.5f, 4.0f, -1.5f});
+    fill_tensor(c, {-2.0f, 0.0f, 12.0f, 1.0f});
+    
+    engine->begin_capture();
+    engine->assign(out, (a * b + c).exp().clamp(0.0f, 2.0f));
+    auto graph = engine->end_capture();
+    
+    EXPECT_EQ(graph.size(), 1u);
+    
+    graph.launch().wait();
+    verify_tensor(out, {1.00000f, 2.00000f, 1.00000f, 1.28403f});
+}
+
+TEST_F(ExpressionTest, ScalarsAndBroadcast) 
+{
+    auto x = engine->create_tensor({2, 3});
+    auto bias = engine->create_tensor({3});
+    auto y = engine->create_tensor({2, 3});
+    fill_tensor(x, {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f});
+    fill_tensor(bias, {10.0f, 20.0f, 30.0f});
+    
+    engine->assign(y, 2.0f * x + bias - 1.0f);
+    engine->execute().wait();
+    
+    verify_tensor(y, {11.0f, 23.0f, 35.0f, 17.0f, 29.0f, 41.0f});
+}
+
+TEST_F(ExpressionTest, TransposedLeaf) 
+{
+    auto a = engine->create_tensor({2, 3});
+    auto b = engine->create_tensor({3, 2});
+    auto c = engine->create_tensor({3, 2});
+    fill_tensor(a, {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f});
+    fill_tensor(b, {1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f});
+    
+    engine->assign(c, -(sb::expr(a.transpose(0, 1)) * b));
+    engine->execute().wait();
+    
+    verify_tensor(c, {-1.0f, -4.0f, -2.0f, -5.0f, -3.0f, -6.0f});
+}
+
+TEST_F(ExpressionTest, DoubleConstantsKeepPrecision) 
+{
+    auto x = engine->create_tensor({2}, sb::Core::DataType::FLOAT64);
+    auto y = engine->create_tensor({2}, sb::Core::DataType::FLOAT64);
+    fill_tensor<double>(x, {0.0, 4.0});
+    
+    // 1 + 1e-9 rounds to 1 in float, so the constant must stay double until the kernel is built
+    engine->assign(y, (x + (1.0 + 1e-9)).clamp(0.0, 2.0 + 1e-9));
+    engine->execute().wait();
+    
+    EXPECT_DOUBLE_EQ(y.data_as<double>()[0], 1.0 + 1e-9);
+    EXPECT_DOUBLE_EQ(y.data_as<double>()[1], 2.0 + 1e-9);
+}
+
+TEST_F(ExpressionTest, OutputAsLeaf) 
+{
+    auto a = engine->create_tensor({2, 2});
+    auto b = engine->create_tensor({2, 2});
+    fill_tensor(a, {1.0f, 2.0f, 3.0f, 4.0f});
+    fill_tensor(b, {1.0f, 1.0f, 1.0f, 1.0f});
+    
+    // the same view of the output is read element for element, so it is allowed
+    engine->assign(a, a * 2.0f + b);
+    engine->execute().wait();
+    verify_tensor(a, {3.0f, 5.0f, 7.0f, 9.0f});
+    
+    // a transposed view of the output would read elements that were already written
+    EXPECT_THROW(engine->assign(a, sb::expr(a.transpose(0, 1)) + b), std::runtime_error);
+}
@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <SushiBLAS/SushiBLAS.h>
+#include "../../test_common.hpp"
+
+class FmaTest : public SushiBLASTest {};
+
+TEST_F(FmaTest, FloatForward) 
+{
+    auto a = engine->create_tensor({4});
+    auto b = engine->create_tensor({4});
+    auto c = engine->create_tensor({4});
+    auto out = engine->create_tensor({4});
+    fill_tensor(a, {1.0f, 2.0f, -3.0f, 0.5f});
+    fill_tensor(b, {2.0f, 0.5f, 4.0f, -1.5f});
+    fill_tensor(c, {1.0f, 1.0f, 1.0f, 1.0f});
+    
+    engine->elementwise().fma(a, b, c, out);
+    engine->execute().wait();
+    
+    verify_tensor(out, {3.00000f, 2.00000f, -11.00000f, 0.25000f});
+}
+
+TEST_F(FmaTest, BroadcastScaleAndShift) 
+{
+    auto x = engine->create_tensor({2, 3});
+    auto gamma = engine->create_tensor({3});
+    auto beta = engine->create_tensor({3});
+    auto y = engine->create_tensor({2, 3});
+    fill_tensor(x, {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f});
+    fill_tensor(gamma, {2.0f, 1.0f, 0.5f});
+    fill_tensor(beta, {0.0f, 10.0f, 100.0f});
+    
+    engine->elementwise().fma(x, gamma, beta, y);
+    engine->execute().wait();
+    
+    verify_tensor(y, {2.0f, 12.0f, 101.5f, 8.0f, 15.0f, 103.0f});
+}
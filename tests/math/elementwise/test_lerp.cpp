@@ -0,0 +1,36 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <SushiBLAS/SushiBLAS.h>
+#include "../../test_common.hpp"
+
+class LerpTest : public SushiBLASTest {};
+
+TEST_F(LerpTest, TensorWeight) 
+{
+    auto start = engine->create_tensor({4});
+    auto end = engine->create_tensor({4});
+    auto weight = engine->create_tensor({4});
+    auto out = engine->create_tensor({4});
+    fill_tensor(start, {0.0f, 1.0f, -2.0f, 4.0f});
+    fill_tensor(end, {10.0f, 3.0f, 2.0f, 0.0f});
+    fill_tensor(weight, {0.5f, 0.0f, 0.25f, 1.0f});
+    
+    engine->elementwise().lerp(start, end, weight, out);
+    engine->execute().wait();
+    
+    verify_tensor(out, {5.00000f, 1.00000f, -1.00000f, 0.00000f});
+}
+
+TEST_F(LerpTest, ScalarWeight) 
+{
+    auto start = engine->create_tensor({4});
+    auto end = engine->create_tensor({4});
+    auto out = engine->create_tensor({4});
+    fill_tensor(start, {0.0f, 1.0f, -2.0f, 4.0f});
+    fill_tensor(end, {10.0f, 3.0f, 2.0f, 0.0f});
+    
+    engine->elementwise().lerp(start, end, 0.25f, out);
+    engine->execute().wait();
+    
+    verify_tensor(out, {2.50000f, 1.50000f, -1.00000f, 3.00000f});
+}
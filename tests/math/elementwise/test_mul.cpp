@@ -18,3 +18,17 @@ TEST_F(MulTest, FloatForward)
     
     verify_tensor(c, {2.00000f, 1.00000f, -12.00000f, -0.75000f});
 }
+
+TEST_F(MulTest, BroadcastPerChannel) 
+{
+    auto x = engine->create_tensor({2, 3});
+    auto scale = engine->create_tensor({2, 1});
+    auto y = engine->create_tensor({2, 3});
+    fill_tensor(x, {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f});
+    fill_tensor(scale, {2.0f, -1.0f});
+    
+    engine->elementwise().mul(x, scale, y);
+    engine->execute().wait();
+    
+    verify_tensor(y, {2.0f, 4.0f, 6.0f, -4.0f, -5.0f, -6.0f});
+}
@@ -18,3 +18,17 @@ TEST_F(SubTest, FloatForward)
     
     verify_tensor(c, {-1.00000f, 1.50000f, -7.00000f, 2.00000f});
 }
+
+TEST_F(SubTest, BroadcastBothInputs) 
+{
+    auto a = engine->create_tensor({3, 1});
+    auto b = engine->create_tensor({1, 2});
+    auto c = engine->create_tensor({3, 2});
+    fill_tensor(a, {1.0f, 2.0f, 3.0f});
+    fill_tensor(b, {10.0f, 20.0f});
+    
+    engine->elementwise().sub(a, b, c);
+    engine->execute().wait();
+    
+    verify_tensor(c, {-9.0f, -19.0f, -8.0f, -18.0f, -7.0f, -17.0f});
+}
@@ -61,3 +61,35 @@ TEST_F(ReLUTest, Backward)
     
     verify_tensor(dx, {0.0f, 0.0f, 3.0f, 4.0f});
 }
+
+TEST_F(ReLUTest, ForwardColumnSlice) 
+{
+    auto t = engine->create_tensor({2, 3});
+    fill_tensor(t, {-1.0f, -2.0f, -3.0f, -4.0f, -5.0f, 6.0f});
+    
+    auto tail = t.slice(1, 1, 3);
+    engine->nonlinear().relu(tail);
+    engine->execute().wait();
+    
+    // t[3] is outside the slice and must keep its negative value
+    verify_tensor(t, {-1.0f, 0.0f, 0.0f, -4.0f, 0.0f, 6.0f});
+}
+
+TEST_F(ReLUTest, ForwardVectorisedWithTail) 
+{
+    const int N = 37;
+    auto t = engine->create_tensor({N});
+    
+    std::vector<float> values(N), expected(N);
+    for (int i = 0; i < N; ++i)
+    {
+        values[i] = (i % 2 == 0) ? static_cast<float>(i) : -static_cast<float>(i);
+        expected[i] = (i % 2 == 0) ? static_cast<float>(i) : 0.0f;
+    }
+    fill_tensor(t, values);
+    
+    engine->nonlinear().relu(t);
+    engine->execute().wait();
+    
+    verify_tensor(t, expected);
+}
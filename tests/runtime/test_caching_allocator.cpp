@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <SushiBLAS/SushiBLAS.h>
+#include "../test_common.hpp"
+
+class CachingAllocatorTest : public SushiBLASTest {};
+
+TEST_F(CachingAllocatorTest, SizeClasses)
+{
+    EXPECT_EQ(sb::CachingAllocator::size_class(1), 128u);
+    EXPECT_EQ(sb::CachingAllocator::size_class(300), 512u);
+    EXPECT_EQ(sb::CachingAllocator::size_class(4096), 4096u);
+    EXPECT_EQ(sb::CachingAllocator::size_class(5000), 5120u);
+    EXPECT_EQ(sb::CachingAllocator::size_class(1 << 20), size_t(1) << 20);
+}
+
+TEST_F(CachingAllocatorTest, ReusesFreedTensors)
+{
+    const int N = 64 * 1024;
+    {
+        auto a = engine->create_tensor({N});
+        auto s = engine->create_tensor({1});
+    }
+    sb::MemoryStats before = engine->memory_stats();
+    EXPECT_EQ(before.in_use_bytes, 0u);
+    EXPECT_GT(before.cached_bytes, 0u);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        auto a = engine->create_tensor({N});
+        auto s = engine->create_tensor({1});
+        fill_tensor(a, std::vector<float>(N, 1.0f));
+        engine->blas().scal(2.0f, a);
+        engine->execute().wait();
+        verify_tensor(a, std::vector<float>(N, 2.0f));
+    }
+
+    sb::MemoryStats after = engine->memory_stats();
+    EXPECT_EQ(after.reserved_bytes, before.reserved_bytes);
+    EXPECT_EQ(after.hits, before.hits + 8);
+    EXPECT_GE(after.peak_bytes, N * sizeof(float));
+
+    EXPECT_GE(engine->trim_memory(), N * sizeof(float));
+    EXPECT_LT(engine->memory_stats().reserved_bytes, before.reserved_bytes);
+}
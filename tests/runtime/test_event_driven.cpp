@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <SushiBLAS/SushiBLAS.h>
+#include "../test_common.hpp"
+
+class EventDrivenTest : public SushiBLASTest {};
+
+TEST_F(EventDrivenTest, Chain)
+{
+    engine->set_execution_mode(sb::Core::ExecutionMode::EVENT_DRIVEN);
+    engine->set_fusion_enabled(false);
+
+    auto a = engine->create_tensor({4});
+    auto b = engine->create_tensor({4});
+    auto c = engine->create_tensor({4});
+    fill_tensor(a, {1.0f, -2.0f, 3.0f, -4.0f});
+    fill_tensor(b, {1.0f, 1.0f, 1.0f, 1.0f});
+
+    engine->elementwise().add(a, b, c);
+    engine->nonlinear().relu(c);
+    engine->blas().scal(2.0f, c);
+    engine->execute().wait();
+
+    verify_tensor(c, {4.0f, 0.0f, 8.0f, 0.0f});
+}
+
+TEST_F(EventDrivenTest, MixedWithScheduled)
+{
+    const int N = 8;
+    auto x = engine->create_tensor({N, N});
+    auto w = engine->create_tensor({N, N});
+    auto y = engine->create_tensor({N, N});
+    fill_tensor(x, std::vector<float>(N * N, 1.0f));
+    fill_tensor(w, std::vector<float>(N * N, 0.5f));
+
+    // the second epoch is submitted while the first may still run
+    engine->blas().gemm(x, w, y);
+    engine->execute();
+
+    engine->set_execution_mode(sb::Core::ExecutionMode::EVENT_DRIVEN);
+    engine->nonlinear().relu(y);
+    engine->blas().scal(0.5f, y);
+    engine->execute().wait();
+
+    verify_tensor(y, std::vector<float>(N * N, 2.0f));
+}
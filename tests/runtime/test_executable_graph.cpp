@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <SushiBLAS/SushiBLAS.h>
+#include "../test_common.hpp"
+
+class ExecutableGraphTest : public SushiBLASTest {};
+
+TEST_F(ExecutableGraphTest, CaptureDoesNotExecute) 
+{
+    auto a = engine->create_tensor({4});
+    fill_tensor(a, {-1.0f, 2.0f, -3.0f, 4.0f});
+
+    engine->begin_capture();
+    engine->nonlinear().relu(a);
+    auto graph = engine->end_capture();
+
+    engine->execute().wait();
+
+    EXPECT_EQ(graph.size(), 1u);
+    verify_tensor(a, {-1.0f, 2.0f, -3.0f, 4.0f});
+}
+
+TEST_F(ExecutableGraphTest, ReplayChain) 
+{
+    auto a = engine->create_tensor({4});
+    auto b = engine->create_tensor({4});
+    auto c = engine->create_tensor({4});
+    fill_tensor(a, {1.0f, -2.0f, 3.0f, -4.0f});
+    fill_tensor(b, {1.0f, 1.0f, 1.0f, 1.0f});
+
+    // keep add and relu as two tasks so the edge between them is checked
+    engine->set_fusion_enabled(false);
+
+    engine->begin_capture();
+    engine->elementwise().add(a, b, c);
+    engine->nonlinear().relu(c);
+    auto graph = engine->end_capture();
+
+    EXPECT_EQ(graph.size(), 2u);
+    EXPECT_EQ(graph.num_edges(), 1u);
+
+    graph.launch().wait();
+    verify_tensor(c, {2.0f, 0.0f, 4.0f, 0.0f});
+
+    // replay with new inputs, the same graph sees the new data
+    fill_tensor(a, {-5.0f, 5.0f, -1.0f, 1.0f});
+    graph.launch().wait();
+    verify_tensor(c, {0.0f, 6.0f, 0.0f, 2.0f});
+}
+
+TEST_F(ExecutableGraphTest, ReplayGemmLayers) 
+{
+    const int N = 16;
+    auto x = engine->create_tensor({N, N});
+    auto w = engine->create_tensor({N, N});
+    auto y = engine->create_tensor({N, N});
+    fill_tensor(x, std::vector<float>(N * N, 1.0f));
+    fill_tensor(w, std::vector<float>(N * N, 0.5f));
+
+    engine->begin_capture();
+    auto h = engine->create_tensor({N, N});
+    engine->blas().gemm(x, w, h);
+    engine->blas().gemm(h, w, y);
+    auto graph = engine->end_capture();
+
+    for (int step = 0; step < 3; ++step)
+        graph.launch();
+    graph.launch().wait();
+
+    // h = 8, y = 8 * 0.5 * 16 = 64
+    verify_tensor(y, std::vector<float>(N * N, 64.0f));
+}
+
+TEST_F(ExecutableGraphTest, OrderedWithEngineEpochs) 
+{
+    auto v = engine->create_tensor({4});
+    fill_tensor(v, {1.0f, 1.0f, 1.0f, 1.0f});
+
+    engine->begin_capture();
+    engine->blas().scal(2.0f, v);
+    auto graph = engine->end_capture();
+
+    // none of these are waited on: the launch must sit between the two epochs
+    engine->elementwise().add(v, v, v);
+    engine->execute();
+    graph.launch();
+    engine->elementwise().add(v, v, v);
+    engine->execute().wait();
+
+    verify_tensor(v, {8.0f, 8.0f, 8.0f, 8.0f});
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <SushiBLAS/SushiBLAS.h>
+#include "../test_common.hpp"
+
+class FusionTest : public SushiBLASTest {};
+
+TEST_F(FusionTest, AddReluClamp) 
+{
+    auto a = engine->create_tensor({6});
+    auto b = engine->create_tensor({6});
+    auto c = engine->create_tensor({6});
+    fill_tensor(a, {-3.0f, -1.0f, 0.5f, 1.0f, 2.0f, 4.0f});
+    fill_tensor(b, {1.0f, 0.5f, 0.0f, 0.5f, 0.5f, 1.0f});
+
+    engine->elementwise().add(a, b, c);
+    engine->nonlinear().relu(c);
+    engine->elementwise().clamp(c, 0.0f, 2.0f);
+    engine->execute().wait();
+
+    verify_tensor(c, {0.0f, 0.0f, 0.5f, 1.5f, 2.0f, 2.0f});
+}
+
+TEST_F(FusionTest, MatchesUnfused) 
+{
+    const int N = 1024;
+    std::vector<float> data(N);
+    for (int i = 0; i < N; ++i) 
+        data[i] = (i - N / 2) * 0.01f;
+
+    auto fused = engine->create_tensor({N});
+    auto plain = engine->create_tensor({N});
+    fill_tensor(fused, data);
+    fill_tensor(plain, data);
+
+    engine->nonlinear().gelu(fused);
+    engine->elementwise().square(fused);
+    engine->nonlinear().leaky_relu(fused, 0.1f);
+    engine->elementwise().pow(fused, 0.5f);
+    engine->execute().wait();
+
+    engine->set_fusion_enabled(false);
+    engine->nonlinear().gelu(plain);
+    engine->elementwise().square(plain);
+    engine->nonlinear().leaky_relu(plain, 0.1f);
+    engine->elementwise().pow(plain, 0.5f);
+    engine->execute().wait();
+
+    verify_tensor(fused, std::vector<float>(plain.data_as<float>(), plain.data_as<float>() + N));
+}
+
+TEST_F(FusionTest, ReaderBreaksChain) 
+{
+    auto a = engine->create_tensor({4});
+    auto b = engine->create_tensor({4});
+    auto c = engine->create_tensor({4});
+    auto d = engine->create_tensor({4});
+    fill_tensor(a, {-1.0f, 2.0f, -3.0f, 4.0f});
+    fill_tensor(b, {1.0f, 1.0f, 1.0f, 1.0f});
+
+    // d must see c before relu, so relu cannot be fused into the add
+    engine->elementwise().add(a, b, c);
+    engine->elementwise().mul(c, b, d);
+    engine->nonlinear().relu(c);
+    engine->execute().wait();
+
+    verify_tensor(d, {0.0f, 3.0f, -2.0f, 5.0f});
+    verify_tensor(c, {0.0f, 3.0f, 0.0f, 5.0f});
+}
+
+TEST_F(FusionTest, ReaderBreaksChainOnSlice) 
+{
+    auto a = engine->create_tensor({4});
+    auto b = engine->create_tensor({4});
+    auto d = engine->create_tensor({4});
+    auto buffer = engine->create_tensor({8});
+    fill_tensor(a, {-1.0f, 2.0f, -3.0f, 4.0f});
+    fill_tensor(b, {1.0f, 1.0f, 1.0f, 1.0f});
+
+    // c starts in the middle of its allocation, so its data pointer is not the allocation base
+    auto c = buffer.slice(0, 4, 8);
+
+    engine->elementwise().add(a, b, c);
+    engine->elementwise().mul(c, b, d);
+    engine->nonlinear().relu(c);
+    engine->execute().wait();
+
+    verify_tensor(d, {0.0f, 3.0f, -2.0f, 5.0f});
+}
+
+TEST_F(FusionTest, CapturedChainIsOneTask) 
+{
+    auto a = engine->create_tensor({4}, sb::Core::DataType::FLOAT64);
+    auto b = engine->create_tensor({4}, sb::Core::DataType::FLOAT64);
+    auto c = engine->create_tensor({4}, sb::Core::DataType::FLOAT64);
+    fill_tensor<double>(a, {1.0, -2.0, 3.0, -4.0});
+    fill_tensor<double>(b, {2.0, 2.0, 2.0, 2.0});
+
+    engine->begin_capture();
+    engine->elementwise().mul(a, b, c);
+    engine->nonlinear().relu(c);
+    engine->elementwise().neg(c);
+    auto graph = engine->end_capture();
+
+    EXPECT_EQ(graph.size(), 1u);
+
+    graph.launch().wait();
+    verify_tensor<double>(c, {-2.0, 0.0, -6.0, 0.0});
+}
@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <SushiBLAS/SushiBLAS.h>
+#include "../test_common.hpp"
+
+class LanesTest : public SushiBLASTest {};
+
+TEST_F(LanesTest, IndependentChains)
+{
+    const int N = 16;
+    const int MODELS = 8;
+    size_t lanes = engine->set_lane_count(4);
+    EXPECT_GE(lanes, 1u);
+    EXPECT_LE(lanes, 4u);
+    EXPECT_EQ(engine->get_lane_count(), lanes);
+
+    auto w = engine->create_tensor({N, N});
+    fill_tensor(w, std::vector<float>(N * N, 0.5f));
+
+    std::vector<sb::Tensor> xs, ys;
+    for (int m = 0; m < MODELS; ++m)
+    {
+        xs.push_back(engine->create_tensor({N, N}));
+        ys.push_back(engine->create_tensor({N, N}));
+        fill_tensor(xs[m], std::vector<float>(N * N, static_cast<float>(m)));
+    }
+
+    for (int m = 0; m < MODELS; ++m)
+    {
+        engine->blas().gemm(xs[m], w, ys[m]);
+        engine->nonlinear().relu(ys[m]);
+    }
+    engine->execute().wait();
+
+    for (int m = 0; m < MODELS; ++m)
+        verify_tensor(ys[m], std::vector<float>(N * N, m * N * 0.5f));
+}
+
+TEST_F(LanesTest, SingleLane)
+{
+    EXPECT_EQ(engine->set_lane_count(1), 1u);
+    EXPECT_EQ(engine->get_lane_count(), 1u);
+
+    auto a = engine->create_tensor({4});
+    fill_tensor(a, {-1.0f, 2.0f, -3.0f, 4.0f});
+    engine->nonlinear().relu(a);
+    engine->execute().wait();
+
+    verify_tensor(a, {0.0f, 2.0f, 0.0f, 4.0f});
+}
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <SushiBLAS/SushiBLAS.h>
+#include "../test_common.hpp"
+
+class MemoryPlannerTest : public SushiBLASTest {};
+
+TEST_F(MemoryPlannerTest, DisjointLifetimesShareOffsets)
+{
+    // a and c are never live together, b overlaps both
+    std::vector<sb::PlannedBuffer> buffers(3);
+    int tags[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        buffers[i].base = &tags[i];
+        buffers[i].bytes = 256;
+    }
+    buffers[0].first = 0; buffers[0].last = 2;
+    buffers[1].first = 2; buffers[1].last = 4;
+    buffers[2].first = 4; buffers[2].last = 5;
+
+    size_t arena = sb::assign_offsets(buffers, 64);
+
+    EXPECT_EQ(arena, 512u);
+    EXPECT_EQ(buffers[0].offset, buffers[2].offset);
+    EXPECT_NE(buffers[0].offset, buffers[1].offset);
+}
+
+TEST_F(MemoryPlannerTest, CapturedIntermediatesShareArena)
+{
+    const int N = 64;
+    auto x = engine->create_tensor({N});
+    auto out = engine->create_tensor({N});
+    fill_tensor(x, std::vector<float>(N, 1.0f));
+
+    auto graph = engine->capture_planned([&]() 
+    {
+        auto t1 = engine->create_tensor({N});
+        auto t2 = engine->create_tensor({N});
+        auto t3 = engine->create_tensor({N});
+
+        engine->blas().copy(x, t1);
+        engine->blas().scal(2.0f, t1);
+        engine->blas().copy(t1, t2);
+        engine->blas().scal(3.0f, t2);
+        engine->blas().copy(t2, t3);
+        engine->blas().scal(0.5f, t3);
+        engine->blas().copy(t3, out);
+    });
+
+    const sb::MemoryPlan& plan = engine->get_memory_plan();
+    ASSERT_EQ(plan.buffers.size(), 3u);
+    EXPECT_EQ(plan.naive_bytes, 3u * N * sizeof(float));
+    EXPECT_LT(plan.arena_bytes, plan.naive_bytes);
+    EXPECT_EQ(plan.buffers[0].offset, plan.buffers[2].offset);
+
+    graph.launch().wait();
+    verify_tensor(out, std::vector<float>(N, 3.0f));
+
+    // the graph can be replayed with the same arena
+    fill_tensor(x, std::vector<float>(N, 2.0f));
+    graph.launch().wait();
+    verify_tensor(out, std::vector<float>(N, 6.0f));
+}
+
+TEST_F(MemoryPlannerTest, FailedCaptureLeavesEngineUsable)
+{
+    const int N = 8;
+    auto x = engine->create_tensor({N});
+    fill_tensor(x, std::vector<float>(N, 1.0f));
+
+    // the second pass creates one tensor more than the first
+    int pass = 0;
+    EXPECT_THROW(engine->capture_planned([&]() 
+    {
+        auto t1 = engine->create_tensor({N});
+        if (++pass == 2)
+        {
+            auto extra = engine->create_tensor({N});
+        }
+        engine->blas().copy(x, t1);
+    }), std::runtime_error);
+
+    EXPECT_FALSE(engine->is_capturing());
+
+    engine->blas().scal(2.0f, x);
+    engine->execute().wait();
+    verify_tensor(x, std::vector<float>(N, 2.0f));
+}
@@ -0,0 +1,32 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <SushiBLAS/SushiBLAS.h>
+#include "../test_common.hpp"
+
+class NumaPlacementTest : public SushiBLASTest {};
+
+TEST_F(NumaPlacementTest, RangeCarriesNode)
+{
+    auto a = engine->create_tensor_on_node({4, 4}, sb::Core::DataType::FLOAT32, 0);
+    auto b = engine->create_tensor({4, 4});
+
+    EXPECT_EQ(a.access_range().numa_node, 0);
+    EXPECT_EQ(a.slice(0, 1, 3).access_range().numa_node, 0);
+    EXPECT_EQ(b.access_range().numa_node, -1);
+}
+
+TEST_F(NumaPlacementTest, GemmOnNode)
+{
+    const int N = 16;
+    auto x = engine->create_tensor_on_node({N, N}, sb::Core::DataType::FLOAT32, 0);
+    auto w = engine->create_tensor_on_node({N, N}, sb::Core::DataType::FLOAT32, 0);
+    auto y = engine->create_tensor_on_node({N, N}, sb::Core::DataType::FLOAT32, 0);
+    fill_tensor(x, std::vector<float>(N * N, 1.0f));
+    fill_tensor(w, std::vector<float>(N * N, 0.5f));
+
+    engine->blas().gemm(x, w, y);
+    engine->nonlinear().relu(y);
+    engine->execute().wait();
+
+    verify_tensor(y, std::vector<float>(N * N, N * 0.5f));
+}
@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <SushiBLAS/SushiBLAS.h>
+#include "../test_common.hpp"
+
+class OpStatsTest : public SushiBLASTest {};
+
+TEST_F(OpStatsTest, CountsGemmAndElementwise)
+{
+    const int N = 16;
+    engine->set_stats_enabled(true);
+    engine->set_fusion_enabled(false);
+
+    auto x = engine->create_tensor({N, N});
+    auto w = engine->create_tensor({N, N});
+    auto y = engine->create_tensor({N, N});
+    fill_tensor(x, std::vector<float>(N * N, 1.0f));
+    fill_tensor(w, std::vector<float>(N * N, 0.5f));
+
+    for (int i = 0; i < 3; ++i)
+    {
+        engine->blas().gemm(x, w, y);
+        engine->elementwise().add(y, x, y);
+    }
+    engine->execute().wait();
+
+    auto entries = engine->stats().snapshot();
+    const sb::OpStatsEntry* gemm = nullptr;
+    const sb::OpStatsEntry* add = nullptr;
+    for (const auto& e : entries)
+    {
+        if (e.name == "blas.lvl3.gemm") gemm = &e;
+        if (e.name == "math.ew.add") add = &e;
+    }
+
+    ASSERT_NE(gemm, nullptr);
+    ASSERT_NE(add, nullptr);
+    EXPECT_EQ(gemm->calls, 3u);
+    EXPECT_EQ(gemm->flops, 3u * 2u * N * N * N);
+    EXPECT_GT(gemm->bytes, 0u);
+    EXPECT_GE(gemm->p99_ms, gemm->p50_ms);
+    EXPECT_EQ(add->calls, 3u);
+    EXPECT_EQ(add->flops, 3u * N * N);
+
+    engine->stats().reset();
+    EXPECT_TRUE(engine->stats().snapshot().empty());
+}
@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <SushiBLAS/SushiBLAS.h>
+#include "../test_common.hpp"
+
+class PriorityTest : public SushiBLASTest {};
+
+TEST_F(PriorityTest, CriticalPathFirst)
+{
+    const int N = 32;
+    auto side = engine->create_tensor({4});
+    auto x = engine->create_tensor({N, N});
+    auto w = engine->create_tensor({N, N});
+    auto y1 = engine->create_tensor({N, N});
+    auto y2 = engine->create_tensor({N, N});
+    fill_tensor(side, {-1.0f, 2.0f, -3.0f, 4.0f});
+    fill_tensor(x, std::vector<float>(N * N, 1.0f));
+    fill_tensor(w, std::vector<float>(N * N, 0.5f));
+
+    // the side task is recorded first but does not lie on the long chain
+    engine->begin_capture();
+    engine->nonlinear().relu(side);
+    engine->blas().gemm(x, w, y1);
+    engine->blas().gemm(y1, w, y2);
+    auto graph = engine->end_capture();
+
+    auto order = graph.submission_order();
+    ASSERT_EQ(order.size(), 3u);
+    EXPECT_EQ(order[0], 1u);
+    EXPECT_EQ(order[1], 2u);
+    EXPECT_EQ(order[2], 0u);
+
+    graph.launch().wait();
+    verify_tensor(side, {0.0f, 2.0f, 0.0f, 4.0f});
+    verify_tensor(y2, std::vector<float>(N * N, N * 0.5f * N * 0.5f));
+}
+
+TEST_F(PriorityTest, ReorderedEpochKeepsEdges)
+{
+    const int N = 16;
+    auto a = engine->create_tensor({N});
+    auto x = engine->create_tensor({N, N});
+    auto w = engine->create_tensor({N, N});
+    auto y = engine->create_tensor({N, N});
+    fill_tensor(a, std::vector<float>(N, 1.0f));
+    fill_tensor(x, std::vector<float>(N * N, 1.0f));
+    fill_tensor(w, std::vector<float>(N * N, 1.0f));
+
+    engine->blas().scal(2.0f, a);
+    engine->blas().scal(3.0f, a);
+    engine->blas().gemm(x, w, y);
+    engine->blas().scal(0.5f, y);
+    engine->execute().wait();
+
+    verify_tensor(a, std::vector<float>(N, 6.0f));
+    verify_tensor(y, std::vector<float>(N * N, N * 0.5f));
+}
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <SushiBLAS/SushiBLAS.h>
+#include "../test_common.hpp"
+
+class ProfilerTest : public SushiBLASTest {};
+
+TEST_F(ProfilerTest, WritesChromeTrace)
+{
+    const int N = 16;
+    engine->set_profiling_enabled(true);
+
+    auto x = engine->create_tensor({N, N});
+    auto w = engine->create_tensor({N, N});
+    auto y = engine->create_tensor({N, N});
+    fill_tensor(x, std::vector<float>(N * N, 1.0f));
+    fill_tensor(w, std::vector<float>(N * N, 0.5f));
+
+    engine->blas().gemm(x, w, y);
+    engine->nonlinear().relu(y);
+    engine->execute().wait();
+
+    verify_tensor(y, std::vector<float>(N * N, N * 0.5f));
+    EXPECT_EQ(engine->profiler().size(), 2u);
+
+    const std::string path = "profiler_test_trace.json";
+    engine->profiler().write_chrome_trace(path);
+
+    std::ifstream ifs(path);
+    ASSERT_TRUE(ifs.is_open());
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    std::string json = ss.str();
+
+    EXPECT_NE(json.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(json.find("blas.lvl3.gemm"), std::string::npos);
+    EXPECT_NE(json.find("\"cat\":\"submit\""), std::string::npos);
+
+    // both tasks ran on the engine's one queue, so the device side has a single track
+    EXPECT_EQ(json.find("\"queue 1\""), std::string::npos);
+    std::remove(path.c_str());
+}
+
+TEST_F(ProfilerTest, DisabledRecordsNothing)
+{
+    auto a = engine->create_tensor({4});
+    fill_tensor(a, {-1.0f, 2.0f, -3.0f, 4.0f});
+
+    engine->nonlinear().relu(a);
+    engine->execute().wait();
+
+    EXPECT_EQ(engine->profiler().size(), 0u);
+    verify_tensor(a, {0.0f, 2.0f, 0.0f, 4.0f});
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <SushiBLAS/SushiBLAS.h>
+#include "../test_common.hpp"
+
+class RangeTrackingTest : public SushiBLASTest {};
+
+TEST_F(RangeTrackingTest, DisjointSlicesHaveNoEdge)
+{
+    auto v = engine->create_tensor({8});
+    fill_tensor(v, {1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f});
+    auto lo = v.slice(0, 0, 4);
+    auto hi = v.slice(0, 4, 8);
+
+    engine->begin_capture();
+    engine->blas().scal(2.0f, lo);
+    engine->blas().scal(3.0f, hi);
+    auto graph = engine->end_capture();
+
+    EXPECT_EQ(graph.size(), 2u);
+    EXPECT_EQ(graph.num_edges(), 0u);
+
+    graph.launch().wait();
+    verify_tensor(v, {2.0f, 2.0f, 2.0f, 2.0f, 3.0f, 3.0f, 3.0f, 3.0f});
+}
+
+TEST_F(RangeTrackingTest, OverlappingSlicesHaveEdge)
+{
+    auto v = engine->create_tensor({8});
+    fill_tensor(v, {1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f});
+    auto lo = v.slice(0, 0, 4);
+    auto mid = v.slice(0, 2, 6);
+
+    engine->begin_capture();
+    engine->blas().scal(2.0f, lo);
+    engine->blas().scal(3.0f, mid);
+    auto graph = engine->end_capture();
+
+    EXPECT_EQ(graph.num_edges(), 1u);
+
+    graph.launch().wait();
+    verify_tensor(v, {2.0f, 2.0f, 6.0f, 6.0f, 3.0f, 3.0f, 1.0f, 1.0f});
+}
+
+TEST_F(RangeTrackingTest, OrderAcrossEpochs)
+{
+    auto v = engine->create_tensor({8});
+    fill_tensor(v, {1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f});
+    auto lo = v.slice(0, 0, 4);
+    auto mid = v.slice(0, 2, 6);
+
+    // the second epoch is sent before the first one is waited on
+    engine->blas().scal(2.0f, lo);
+    engine->execute();
+    engine->blas().scal(3.0f, mid);
+    engine->execute().wait();
+
+    verify_tensor(v, {2.0f, 2.0f, 6.0f, 6.0f, 3.0f, 3.0f, 1.0f, 1.0f});
+}
+
+TEST_F(RangeTrackingTest, ManySlicesOfOneBuffer)
+{
+    const int SLICES = 64;
+    const int WIDTH = 4;
+    auto v = engine->create_tensor({SLICES * WIDTH});
+    fill_tensor(v, std::vector<float>(SLICES * WIDTH, 1.0f));
+
+    // every slice is scaled, then every pair of neighbours is read together
+    engine->begin_capture();
+    for (int s = 0; s < SLICES; ++s)
+    {
+        auto part = v.slice(0, s * WIDTH, (s + 1) * WIDTH);
+        engine->blas().scal(2.0f, part);
+    }
+    for (int s = 0; s + 1 < SLICES; s += 2)
+    {
+        auto pair = v.slice(0, s * WIDTH, (s + 2) * WIDTH);
+        engine->blas().scal(0.5f, pair);
+    }
+    auto graph = engine->end_capture();
+
+    // each pair waits for exactly its two slices
+    EXPECT_EQ(graph.num_edges(), static_cast<size_t>(SLICES));
+
+    graph.launch().wait();
+    verify_tensor(v, std::vector<float>(SLICES * WIDTH, 1.0f));
+}
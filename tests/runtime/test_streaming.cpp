@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <SushiBLAS/SushiBLAS.h>
+#include "../test_common.hpp"
+
+class StreamingTest : public SushiBLASTest {};
+
+TEST_F(StreamingTest, FlushesAtTaskLimit)
+{
+    sb::StreamingPolicy policy;
+    policy.max_tasks = 3;
+    policy.max_in_flight = 2;
+    engine->set_streaming_policy(policy);
+    engine->set_fusion_enabled(false);
+
+    auto v = engine->create_tensor({4});
+    fill_tensor(v, {1.0f, 1.0f, 1.0f, 1.0f});
+
+    for (int i = 0; i < 8; ++i)
+    {
+        engine->blas().scal(2.0f, v);
+        EXPECT_LT(engine->get_pending_count(), 3u);
+    }
+
+    // 8 tasks with a limit of 3 leave 2 queued
+    EXPECT_EQ(engine->get_pending_count(), 2u);
+    engine->execute().wait();
+
+    verify_tensor(v, {256.0f, 256.0f, 256.0f, 256.0f});
+}
+
+TEST_F(StreamingTest, FlushesAtByteLimit)
+{
+    const int N = 256;
+    sb::StreamingPolicy policy;
+    policy.max_bytes = N * sizeof(float);
+    engine->set_streaming_policy(policy);
+
+    auto a = engine->create_tensor({N});
+    auto b = engine->create_tensor({N});
+    fill_tensor(a, std::vector<float>(N, 1.0f));
+    fill_tensor(b, std::vector<float>(N, 2.0f));
+
+    // a copy moves twice the limit, so it is sent at once
+    engine->blas().copy(a, b);
+    EXPECT_EQ(engine->get_pending_count(), 0u);
+
+    engine->blas().scal(3.0f, b);
+    engine->execute().wait();
+
+    verify_tensor(b, std::vector<float>(N, 3.0f));
+}
+
+TEST_F(StreamingTest, LongQueueFlushesAtEpochLimit)
+{
+    engine->set_fusion_enabled(false);
+
+    auto v = engine->create_tensor({4});
+    fill_tensor(v, {1.0f, 1.0f, 1.0f, 1.0f});
+
+    // more tasks than one epoch can hold, without a streaming policy
+    const size_t count = sb::Engine::MAX_EPOCH_TASKS + 10;
+    for (size_t i = 0; i < count; ++i)
+    {
+        engine->blas().scal(i % 2 == 0 ? 2.0f : 0.5f, v);
+        EXPECT_LT(engine->get_pending_count(), sb::Engine::MAX_EPOCH_TASKS);
+    }
+    engine->execute().wait();
+
+    verify_tensor(v, {1.0f, 1.0f, 1.0f, 1.0f});
+}
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <SushiBLAS/SushiBLAS.h>
+#include "../test_common.hpp"
+
+class TaskArenaTest : public SushiBLASTest {};
+
+TEST_F(TaskArenaTest, ResetReusesBlocks) 
+{
+    sb::TaskArena arena;
+    void* first = arena.allocate(256);
+    for (int i = 0; i < 1000; ++i)
+        arena.allocate(64);
+
+    size_t reserved = arena.bytes_reserved();
+    arena.reset();
+
+    EXPECT_EQ(arena.bytes_used(), 0u);
+    EXPECT_EQ(arena.allocate(256), first);
+    for (int i = 0; i < 1000; ++i)
+        arena.allocate(64);
+    EXPECT_EQ(arena.bytes_reserved(), reserved);
+}
+
+TEST_F(TaskArenaTest, ResetRunsDestructors) 
+{
+    int destroyed = 0;
+    struct Counter 
+    {
+        int* count;
+        ~Counter() { ++(*count); }
+    };
+
+    sb::TaskArena arena;
+    arena.create<Counter>(&destroyed);
+    arena.create<Counter>(&destroyed);
+    EXPECT_EQ(destroyed, 0);
+
+    arena.reset();
+    EXPECT_EQ(destroyed, 2);
+}
+
+TEST_F(TaskArenaTest, ManyEpochs) 
+{
+    auto a = engine->create_tensor({4});
+    auto b = engine->create_tensor({4});
+    auto c = engine->create_tensor({4});
+    fill_tensor(a, {-1.0f, 2.0f, -3.0f, 4.0f});
+    fill_tensor(b, {1.0f, 1.0f, 1.0f, 1.0f});
+
+    auto a2 = a.reshape({2, 2});
+    auto b2 = b.reshape({2, 2});
+    auto c2 = c.reshape({2, 2});
+
+    for (int step = 0; step < 50; ++step)
+    {
+        engine->elementwise().add(a, b, c);
+        engine->nonlinear().relu(c);
+        engine->blas().gemm(a2, b2, c2);
+        engine->execute().wait();
+    }
+
+    // c = a(2x2) * ones(2x2) -> row sums
+    verify_tensor(c, {1.0f, 1.0f, 1.0f, 1.0f});
+}